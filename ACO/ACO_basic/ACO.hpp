@@ -0,0 +1,219 @@
+#ifndef ACO_HPP
+#define ACO_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/thread_pool.hpp"
+#include "ant.hpp"
+
+#include <vector>
+#include <random>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <limits>
+
+// Ant Colony Optimization (MAX-MIN Ant System)
+// 每次迭代所有螞蟻平行建構 (各自的 mt19937，種子由 params.seed 經 seed_seq 衍生，結果與執行緒數無關)，
+// 迭代最佳解可以先交給 local search hook 改良，再由迭代最佳 / 全局最佳 (每 global_best_every 次) 更新費洛蒙。
+// 沉積量 Δ = Q / cost，Q 為 HEFT 解的 makespan，所以費洛蒙大約在 1 / ρ 的量級
+
+
+// Local search hook：原地改良 sol (必須維持合法的 ss 並更新 cost)，回傳用掉的評估次數
+// max_evals 為這次最多能用的評估次數 (< 0 = 不限制，來自 budget 剩下的評估數)，回傳值不可超過它
+typedef std::function<long long(Solution& sol, const Config& cfg, std::mt19937& gen, long long max_evals)> ACO_Local_Search;
+
+
+struct ACO_Params {
+    unsigned int seed;          // 隨機種子 (各螞蟻的亂數 stream 由此衍生)
+    unsigned int num_threads;   // 平行建構的執行緒數 (0 = hardware_concurrency，1 = 不開執行緒)
+
+    int num_ants;               // 螞蟻數
+    int max_iter;               // 最大迭代次數
+    int max_NoImprove;          // 全局最佳連續多少代沒變就停止 (0 = 不限制)
+
+    double alpha;               // 費洛蒙權重
+    double beta;                // 啟發值權重 (任務：rank_u；處理器：EFT)
+    double rho;                 // 蒸發率
+    double q0;                  // 直接選權重最大者的機率 (0 = 純輪盤)
+    double p_best;              // MMAS：收斂時建出最佳解的機率，決定 τ_min
+    int global_best_every;      // 每幾次迭代改用全局最佳沉積 (0 = 只用迭代最佳)
+
+    int candidates;             // ready list 超過此數時，只在隨機抽出的 candidates 個任務中挑
+    int order_buckets;          // 任務順序費洛蒙的位置分段數 (T × min(T, order_buckets) 個 float)
+
+    bool use_Heuristic;         // true：以 HEFT 解當作初始的全局最佳 (見 include/heft.hpp)
+    ACO_Local_Search local_search;   // 空的就不做
+
+    ACO_Params()
+    : seed(std::random_device{}()),
+      num_threads(0),
+      num_ants(20),
+      max_iter(200),
+      max_NoImprove(0),
+      alpha(1.0),
+      beta(5.0),
+      rho(0.1),
+      q0(0.0),
+      p_best(0.05),
+      global_best_every(5),
+      candidates(16),
+      order_buckets(32),
+      use_Heuristic(false)
+    {}
+};
+
+
+// 把 [0, n) 切成 pool->size() 段並行執行 body(i)，pool 為 nullptr 或只有一條執行緒時逐一執行
+template <typename Body>
+inline void Parallel_For(int n, Work_Stealing_Pool* pool, const Body& body) {
+    if (!pool || pool->size() <= 1 || n < 2) {
+        for (int i = 0; i < n; ++i) body(i);
+        return;
+    }
+    int chunks = std::min<int>(pool->size(), n);
+    for (int c = 0; c < chunks; ++c) {
+        int lo = (long long)n * c / chunks, hi = (long long)n * (c + 1) / chunks;
+        pool->submit([&body, lo, hi]{
+            for (int i = lo; i < hi; ++i) body(i);
+        });
+    }
+    pool->wait_idle();
+}
+
+
+
+
+// ----- Local Search ------
+// 簡單的 hook：隨機挑任務換到另一台處理器，makespan 變小就接受，最多試 tries 次 (且不超過 max_evals)
+inline ACO_Local_Search ACO_Reassign_Descent(int tries) {
+    return [tries](Solution& sol, const Config& cfg, std::mt19937& gen, long long max_evals) -> long long {
+        int T = cfg.theTCount, P = cfg.thePCount;
+        if (T == 0 || P < 2) return 0;
+        long long n = (max_evals < 0) ? tries : std::min<long long>(tries, max_evals);
+        for (long long i = 0; i < n; ++i) {
+            int t = std::uniform_int_distribution<int>(0, T - 1)(gen);
+            int old = sol.ms[t];
+            sol.ms[t] = (old + 1 + std::uniform_int_distribution<int>(0, P - 2)(gen)) % P;
+            double cost = Calculate_schedule(sol.ss, sol.ms, cfg).makespan;
+            if (cost < sol.cost) sol.cost = cost;
+            else sol.ms[t] = old;
+        }
+        return n;
+    };
+}
+
+
+
+
+// ----- ACO Engine ------
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解
+// (評估次數上限在迭代邊界檢查；螞蟻與 local search 合計不會超過上限)
+// GB_Recorder：每代的全局最佳；CB_Recorder：每代的迭代最佳
+Solution Ant_Colony_Optimize(const Config& cfg, const ACO_Params& params,
+                             vector<double>* GB_Recorder = nullptr, vector<double>* CB_Recorder = nullptr,
+                             Search_Budget* budget = nullptr)
+{
+    if (budget) budget->start();
+    const HEFT_Cache& G = HEFT_Cache_For(cfg);
+    int T = G.T, P = G.P;
+    if (T == 0 || P == 0) {
+        if (budget) budget->finish();
+        return GenerateInitialSolution(cfg, false);
+    }
+    int N = std::max(1, params.num_ants);
+
+    // 1. 費洛蒙與啟發值：Q 取 HEFT 的 makespan，初始費洛蒙為對應的 τ_max
+    Solution heft = HEFT_Solution(cfg);
+    heft.cost = Calculate_schedule(heft.ss, heft.ms, cfg).makespan;
+    const double Q = heft.cost > 0.0 ? heft.cost : 1.0;
+    auto delta = [Q](double cost) { return cost > 0.0 ? Q / cost : 1.0; };
+
+    const double order_avg = std::max(1.0, std::min(params.candidates, T) / 2.0);
+    const double proc_avg = std::max(1.0, P / 2.0);
+    ACO_Pheromone tau;
+    tau.init(T, P, params.order_buckets, (float)(1.0 / params.rho));
+    tau.set_bounds(1.0, params.rho, params.p_best, order_avg, proc_avg);
+
+    double maxRank = *std::max_element(G.rank_u.begin(), G.rank_u.end());
+    std::vector<float> eta_order(T, 1.0f);
+    if (maxRank > 0.0) {
+        for (int t = 0; t < T; ++t)
+            eta_order[t] = (float)ACO_Pow(std::max(G.rank_u[t], 1e-9 * maxRank) / maxRank, params.beta);
+    }
+
+    // 2. 螞蟻與執行緒
+    std::seed_seq seq{params.seed};
+    std::vector<unsigned int> seeds(N + 1);
+    seq.generate(seeds.begin(), seeds.end());
+    std::vector<Ant> ants(N);
+    for (int i = 0; i < N; ++i) ants[i].init(cfg, G, params.candidates, seeds[i]);
+    std::mt19937 ls_gen(seeds[N]);          // local search 用 (主執行緒)
+
+    std::unique_ptr<Work_Stealing_Pool> pool;
+    if (params.num_threads != 1) pool.reset(new Work_Stealing_Pool(params.num_threads));
+
+    Solution globalBest;
+    globalBest.cost = std::numeric_limits<double>::infinity();
+    if (params.use_Heuristic) globalBest = heft;
+
+    // 3. 主迴圈
+    int noImprove = 0;
+    for (int it = 1; it <= params.max_iter; ++it) {
+        // 評估次數上限：只建前 active 隻
+        int active = N;
+        if (budget && budget->max_evals > 0)
+            active = (int)std::min<long long>(N, budget->max_evals - budget->evals);
+        if (active <= 0) break;
+
+        // (A) 平行建構，各螞蟻只讀共用的費洛蒙，只寫自己的緩衝
+        Parallel_For(active, pool.get(), [&](int i) {
+            ants[i].construct(tau, eta_order.data(), params.alpha, params.beta, params.q0);
+        });
+
+        // (B) 迭代最佳 (cost 相同取 index 小者)，交給 local search
+        int b = 0;
+        for (int i = 1; i < active; ++i)
+            if (ants[i].sol.cost < ants[b].sol.cost) b = i;
+        Solution& iterBest = ants[b].sol;
+        long long lsEvals = 0;
+        if (params.local_search) {
+            long long lsLimit = -1;     // budget 扣掉本代 active 隻螞蟻後剩下的評估數
+            if (budget && budget->max_evals > 0) lsLimit = budget->max_evals - budget->evals - active;
+            if (lsLimit != 0) lsEvals = params.local_search(iterBest, cfg, ls_gen, lsLimit);
+        }
+
+        if (iterBest.cost < globalBest.cost) {
+            globalBest = iterBest;
+            noImprove = 0;
+        } else {
+            noImprove++;
+        }
+        if (GB_Recorder) GB_Recorder->push_back(globalBest.cost);
+        if (CB_Recorder) CB_Recorder->push_back(iterBest.cost);
+
+        // (C) MMAS 更新：τ_max 跟著全局最佳，蒸發後由迭代最佳 (或週期性的全局最佳) 沉積
+        tau.set_bounds(delta(globalBest.cost), params.rho, params.p_best, order_avg, proc_avg);
+        tau.evaporate(params.rho);
+        bool useGlobal = params.global_best_every > 0 && it % params.global_best_every == 0;
+        const Solution& source = useGlobal ? globalBest : iterBest;
+        tau.deposit(source, delta(source.cost));
+
+        if (budget) {
+            bool stop = false;
+            for (int i = 0; i < active; ++i) stop = budget->spend(globalBest.cost);
+            if (lsEvals > 0) stop = budget->spend(globalBest.cost, lsEvals);
+            if (stop || active < N) break;
+        }
+        if (params.max_NoImprove > 0 && noImprove >= params.max_NoImprove) {
+            if (budget) budget->finish(Stop_Reason::NO_IMPROVE);
+            break;
+        }
+    }
+
+    if (budget) budget->finish();
+    if (globalBest.ss.empty()) return heft;     // 一代都沒跑
+    return globalBest;
+}
+
+#endif
@@ -0,0 +1,51 @@
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "ACO.hpp"
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <random>
+
+using namespace std;
+using namespace os_display;
+using namespace std::chrono;
+
+
+
+
+int main() {
+    Config cfg = ReadConfigFile("../../datasets/n4_00.dag");
+
+
+    // ----- ACO Parameters ------
+    ACO_Params params;
+    params.num_ants      = 20;     // 螞蟻數 (每代平行建構)
+    params.max_iter      = 200;    // 最大迭代次數
+    params.max_NoImprove = 50;     // 全局最佳連續 50 代沒變就停止
+    params.alpha         = 1.0;    // 費洛蒙權重
+    params.beta          = 5.0;    // 啟發值權重
+    params.rho           = 0.1;    // 蒸發率
+    params.use_Heuristic = true;   // 以 HEFT 解當作初始的全局最佳
+    params.local_search  = ACO_Reassign_Descent(20);   // 迭代最佳解再做處理器重新指派的 local search
+
+    // 停止條件：除了 max_iter 之外的時間 / 評估次數 / 目標 makespan (0 = 不限制)
+    Search_Budget budget(/*time_limit_ms=*/0, /*max_evals=*/0, /*target_cost=*/0);
+
+    vector<double> GB, CB;
+    Solution best = Ant_Colony_Optimize(cfg, params, &GB, &CB, &budget);
+
+    cout << "=== ACO (MMAS) Result ===\n";
+    cout << "Best makespan: " << best.cost << "\n";
+    cout << "Stop reason  : " << Stop_Reason_Name(budget.reason)
+         << " (" << budget.evals << " evals, " << budget.elapsed_ms << " ms)\n";
+    show_solution(best);
+    ScheduleResult sr = Solution_Function(best, cfg, true);
+    cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
+    cout << "Cost : " << sr.makespan << "\n";
+
+    writeTwoVectorsToFile(GB, CB, "data.txt");
+    Call_Py_Visual();
+    return 0;
+}
@@ -0,0 +1,219 @@
+#ifndef ANT_HPP
+#define ANT_HPP
+
+#include "include/modules.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// 螞蟻系統的資料結構：費洛蒙矩陣與單隻螞蟻的建構
+// 費洛蒙分兩張 row-major 的 float 矩陣 (一個任務的資料放在同一條 cache line 附近)：
+//   order[t * B + b]：任務 t 排在 ss 第 b 段位置的偏好 (位置分成 B = min(T, order_buckets) 段，T <= B 時就是經典的 位置 × 任務 矩陣)
+//   proc [t * P + p]：任務 t 放在處理器 p 的偏好
+// 螞蟻從 ready list (前驅都已排的任務) 依 τ_order^α · η^β 挑下一個任務，再依 τ_proc^α · (EFT 最小值 / EFT)^β 挑處理器，
+// 同時以 Calculate_schedule 的規則 (非插入式) 算出開始 / 結束時間，建構完 makespan 就已知，不必另外評估
+
+
+// x^e，常用的 e = 1 / 2 不呼叫 pow
+inline double ACO_Pow(double x, double e) {
+    if (e == 1.0) return x;
+    if (e == 2.0) return x * x;
+    return std::pow(x, e);
+}
+
+
+
+
+// ----- Pheromone ------
+// MMAS：每次更新先蒸發並夾到 τ_min 以上 (單一迴圈，可向量化)，再沉積並夾到 τ_max 以下
+struct ACO_Pheromone {
+    int T = 0, P = 0, B = 1;
+    std::vector<float> order;           // T × B
+    std::vector<float> proc;            // T × P
+    float order_min = 0.0f, proc_min = 0.0f, tau_max = 1.0f;
+
+    void init(int T_, int P_, int buckets, float tau) {
+        T = T_;
+        P = P_;
+        B = std::max(1, std::min(T_, buckets));
+        order.assign((size_t)T * B, tau);
+        proc.assign((size_t)T * P, tau);
+        tau_max = tau;
+    }
+
+    // ss 第 pos 個位置所在的段
+    int bucket(int pos) const { return (int)((long long)pos * B / T); }
+
+    const float* order_row(int t) const { return &order[(size_t)t * B]; }
+    const float* proc_row(int t) const { return &proc[(size_t)t * P]; }
+
+    // MMAS 的上下限：τ_max = Δ_best / ρ；τ_min 讓收斂時每一步選到最佳選項的機率約為 p_best^(1/T)
+    // (avg 為每一步平均的選項數，Stützle & Hoos 2000)
+    void set_bounds(double delta_best, double rho, double p_best, double order_avg, double proc_avg) {
+        tau_max = (float)(delta_best / rho);
+        double p_dec = std::pow(p_best, 1.0 / std::max(1, T));
+        auto lower = [&](double avg) {
+            if (avg <= 1.0) return 0.0f;
+            return (float)std::min((double)tau_max, tau_max * (1.0 - p_dec) / ((avg - 1.0) * p_dec));
+        };
+        order_min = lower(order_avg);
+        proc_min = lower(proc_avg);
+    }
+
+    void evaporate(double rho) {
+        const float keep = (float)(1.0 - rho);
+        float* o = order.data();
+        const float omin = order_min;
+        for (size_t i = 0, n = order.size(); i < n; ++i) o[i] = std::max(omin, o[i] * keep);
+        float* q = proc.data();
+        const float pmin = proc_min;
+        for (size_t i = 0, n = proc.size(); i < n; ++i) q[i] = std::max(pmin, q[i] * keep);
+    }
+
+    void deposit(const Solution& sol, double delta) {
+        const float d = (float)delta;
+        for (int i = 0; i < T; ++i) {
+            int t = sol.ss[i];
+            float& o = order[(size_t)t * B + bucket(i)];
+            o = std::min(tau_max, o + d);
+            float& q = proc[(size_t)t * P + sol.ms[t]];
+            q = std::min(tau_max, q + d);
+        }
+    }
+};
+
+
+
+
+// ----- Ant ------
+// 所有緩衝在 init 配置一次，construct 不配置記憶體；每隻螞蟻有自己的 mt19937
+class Ant {
+public:
+    Solution sol;                       // 建構結果 (ss 為合法拓撲序，cost 為 makespan)
+    std::mt19937 gen;
+
+    void init(const Config& cfg, const HEFT_Cache& G, int candidates, unsigned int seed) {
+        cfg_ = &cfg;
+        G_ = &G;
+        T_ = G.T;
+        P_ = G.P;
+        K_ = std::max(1, candidates);
+        gen.seed(seed);
+        sol.ss.assign(T_, 0);
+        sol.ms.assign(T_, 0);
+        sol.cost = std::numeric_limits<double>::infinity();
+        indeg_.assign(T_, 0);
+        ready_.assign(T_, 0);
+        finish_.assign(T_, 0.0);
+        proc_free_.assign(P_, 0.0);
+        eft_.assign(P_, 0.0);
+        weight_.assign(std::max(K_, P_), 0.0);
+        cand_.assign(K_, 0);
+    }
+
+    // 建一個解，回傳 makespan；O(T · K + (T + E) · P)
+    // eta_order[t] 為已經取過 β 次方的任務啟發值；q0 > 0 時以 q0 的機率直接選權重最大者 (ACS 的偽隨機比例規則)
+    double construct(const ACO_Pheromone& tau, const float* eta_order, double alpha, double beta, double q0) {
+        const HEFT_Cache& G = *G_;
+        int R = 0;
+        for (int t = 0; t < T_; ++t) {
+            indeg_[t] = G.pred_off[t + 1] - G.pred_off[t];
+            if (indeg_[t] == 0) ready_[R++] = t;
+        }
+        std::fill(proc_free_.begin(), proc_free_.end(), 0.0);
+        size_t next = 0;                // 有環時補任務用的拓撲序游標
+        double makespan = 0.0;
+
+        for (int n = 0; n < T_; ++n) {
+            // 1. 從 ready list 挑任務：超過 K 個時只在隨機抽出的 K 個候選中挑
+            int idx;
+            if (R == 0) {
+                // 有環 (不合法的輸入)：依拓撲序補上還沒排的任務
+                while (indeg_[G.topo[next]] < 0) ++next;
+                ready_[R++] = G.topo[next];
+                idx = 0;
+            } else {
+                int b = tau.bucket(n);
+                int k = std::min(R, K_);
+                for (int i = 0; i < k; ++i) {
+                    cand_[i] = (R <= K_) ? i : std::uniform_int_distribution<int>(0, R - 1)(gen);
+                    int t = ready_[cand_[i]];
+                    weight_[i] = ACO_Pow(tau.order_row(t)[b], alpha) * eta_order[t];
+                }
+                idx = cand_[pick(k, q0)];
+            }
+            int t = ready_[idx];
+            ready_[idx] = ready_[--R];
+            indeg_[t] = -1;
+
+            // 2. 挑處理器：EFT 依 Calculate_schedule 的規則 (接在處理器最後)
+            const std::vector<double>& w = cfg_->theCompCost[t];
+            double minEft = std::numeric_limits<double>::infinity();
+            for (int p = 0; p < P_; ++p) {
+                double r = 0.0;
+                for (int e = G.pred_off[t]; e < G.pred_off[t + 1]; ++e) {
+                    int u = G.pred_task[e];
+                    int pu = sol.ms[u];
+                    double comm = (pu != p) ? G.pred_vol[e] * cfg_->theCommRate[pu][p] : 0.0;
+                    r = std::max(r, finish_[u] + comm);
+                }
+                eft_[p] = std::max(r, proc_free_[p]) + w[p];
+                minEft = std::min(minEft, eft_[p]);
+            }
+            const float* tp = tau.proc_row(t);
+            for (int p = 0; p < P_; ++p) {
+                double eta = eft_[p] > 0.0 ? minEft / eft_[p] : 1.0;
+                weight_[p] = ACO_Pow(tp[p], alpha) * ACO_Pow(eta, beta);
+            }
+            int p = pick(P_, q0);
+
+            sol.ss[n] = t;
+            sol.ms[t] = p;
+            finish_[t] = eft_[p];
+            proc_free_[p] = eft_[p];
+            makespan = std::max(makespan, eft_[p]);
+
+            // 3. 入度歸零的後繼進入 ready list
+            for (int e = G.succ_off[t]; e < G.succ_off[t + 1]; ++e) {
+                int s = G.succ_task[e];
+                if (indeg_[s] > 0 && --indeg_[s] == 0) ready_[R++] = s;
+            }
+        }
+        sol.cost = makespan;
+        return makespan;
+    }
+
+private:
+    // 依 weight_[0, n) 挑一個 index：q0 的機率取最大者，否則輪盤法 (權重全為 0 或非有限值時均勻挑)
+    int pick(int n, double q0) {
+        if (n == 1) return 0;
+        if (q0 > 0.0 && std::uniform_real_distribution<double>(0.0, 1.0)(gen) < q0)
+            return std::max_element(weight_.begin(), weight_.begin() + n) - weight_.begin();
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i) sum += weight_[i];
+        if (!(sum > 0.0) || !std::isfinite(sum))
+            return std::uniform_int_distribution<int>(0, n - 1)(gen);
+        double r = std::uniform_real_distribution<double>(0.0, sum)(gen);
+        for (int i = 0; i < n - 1; ++i) {
+            r -= weight_[i];
+            if (r < 0.0) return i;
+        }
+        return n - 1;
+    }
+
+    const Config* cfg_ = nullptr;
+    const HEFT_Cache* G_ = nullptr;
+    int T_ = 0, P_ = 0, K_ = 1;
+    std::vector<int> indeg_;            // 尚未排的前驅數；-1 表示已排
+    std::vector<int> ready_;            // ready list ([0, R) 有效，刪除時與最後一個交換)
+    std::vector<double> finish_;
+    std::vector<double> proc_free_;
+    std::vector<double> eft_;
+    std::vector<double> weight_;
+    std::vector<int> cand_;
+};
+
+#endif
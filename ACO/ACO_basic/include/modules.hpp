@@ -0,0 +1,49 @@
+#ifndef MODULES_HPP
+#define MODULES_HPP
+
+
+#include "config.hpp"
+#include "evaluation.hpp"
+#include "utils.hpp"
+#include "heft.hpp"
+
+
+#include <numeric>
+#include <random>
+using namespace std;
+std::mt19937 rng(std::random_device{}());
+
+
+
+
+
+
+Solution GenerateInitialSolution(const Config& cfg, bool useHeuristic=false){
+    int T = cfg.theTCount;
+    int P = cfg.thePCount;
+    Solution sol;
+
+
+    if (useHeuristic) {
+        // HEFT (見 heft.hpp)
+        return HEFT_Solution(cfg);
+    }
+
+
+    // Process Initial Schedule String
+    sol.ss.resize(T);
+    std::iota(sol.ss.begin(), sol.ss.end(), 0);
+    std::shuffle(sol.ss.begin(), sol.ss.end(), rng);
+
+
+    // Process Initial Matching String
+    sol.ms.resize(T);
+    for (int t = 0; t < T; ++t) {
+        sol.ms[t] = rng() % P;
+    }
+
+    return sol;
+}
+
+
+#endif
\ No newline at end of file
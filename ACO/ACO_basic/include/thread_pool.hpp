@@ -0,0 +1,147 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+// Work-Stealing Thread Pool
+// 每個 worker 有自己的佇列：自己從尾端取 (LIFO)，閒置時從別人佇列的前端偷 (FIFO)
+class Work_Stealing_Pool {
+public:
+    explicit Work_Stealing_Pool(unsigned num_threads = 0) {
+        if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+        if (num_threads == 0) num_threads = 1;
+
+        queues_.reserve(num_threads);
+        for (unsigned i = 0; i < num_threads; ++i)
+            queues_.emplace_back(new Worker_Queue());
+
+        threads_.reserve(num_threads);
+        for (unsigned i = 0; i < num_threads; ++i)
+            threads_.emplace_back([this, i]{ worker_loop(i); });
+    }
+
+    ~Work_Stealing_Pool() {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (auto& th : threads_) th.join();
+    }
+
+    Work_Stealing_Pool(const Work_Stealing_Pool&) = delete;
+    Work_Stealing_Pool& operator=(const Work_Stealing_Pool&) = delete;
+
+    unsigned size() const { return static_cast<unsigned>(threads_.size()); }
+
+    // 提交工作：worker 內提交的放回自己佇列，外部提交則輪流分配
+    void submit(std::function<void()> task) {
+        unsigned target = (current_worker() >= 0 && current_owner() == this)
+                        ? static_cast<unsigned>(current_worker())
+                        : next_queue_++ % size();
+        pending_.fetch_add(1);
+        {
+            std::lock_guard<std::mutex> lock(queues_[target]->m);
+            queues_[target]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex_);
+            ++queued_;
+        }
+        wake_cv_.notify_one();
+    }
+
+    // 等待所有已提交的工作完成
+    void wait_idle() {
+        std::unique_lock<std::mutex> lock(idle_mutex_);
+        idle_cv_.wait(lock, [this]{ return pending_.load() == 0; });
+    }
+
+    // 目前執行緒在 pool 中的編號，非 worker 回傳 -1
+    static int worker_index() { return current_worker(); }
+
+private:
+    struct Worker_Queue {
+        std::mutex m;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker_Queue>> queues_;
+    std::vector<std::thread> threads_;
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    size_t queued_ = 0;          // 尚未被取走的工作數 (受 wake_mutex_ 保護)
+    bool stop_ = false;
+
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    std::atomic<size_t> pending_{0};   // 尚未完成的工作數
+    std::atomic<unsigned> next_queue_{0};
+
+    static int& current_worker() {
+        static thread_local int idx = -1;
+        return idx;
+    }
+    static const Work_Stealing_Pool*& current_owner() {
+        static thread_local const Work_Stealing_Pool* owner = nullptr;
+        return owner;
+    }
+
+    bool pop_local(unsigned i, std::function<void()>& task) {
+        std::lock_guard<std::mutex> lock(queues_[i]->m);
+        if (queues_[i]->tasks.empty()) return false;
+        task = std::move(queues_[i]->tasks.back());
+        queues_[i]->tasks.pop_back();
+        return true;
+    }
+
+    bool steal(unsigned thief, std::function<void()>& task) {
+        unsigned n = size();
+        for (unsigned k = 1; k < n; ++k) {
+            unsigned victim = (thief + k) % n;
+            std::lock_guard<std::mutex> lock(queues_[victim]->m);
+            if (queues_[victim]->tasks.empty()) continue;
+            task = std::move(queues_[victim]->tasks.front());
+            queues_[victim]->tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void worker_loop(unsigned i) {
+        current_worker() = static_cast<int>(i);
+        current_owner()  = this;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                wake_cv_.wait(lock, [this]{ return stop_ || queued_ > 0; });
+                if (queued_ == 0 && stop_) return;
+            }
+
+            std::function<void()> task;
+            if (!pop_local(i, task) && !steal(i, task)) continue;
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                --queued_;
+            }
+
+            task();
+
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(idle_mutex_);
+                idle_cv_.notify_all();
+            }
+        }
+    }
+};
+
+#endif
@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <random>
+#include "include/fox_kernels.hpp"
  
 
 struct FOX_Parameters {
@@ -20,11 +21,12 @@ struct FOX_Parameters {
 
   unsigned int seed;                // 隨機種子
   std::mt19937 rng;                 // 隨機引擎
+  Batch_RNG batch_rng;              // 整批產生的亂數 (位置更新的 kernel 用)
 
   FOX_Parameters(int pop_size , int max_it , double alpha_ , double beta_ , double c1_ , double c2_ , double p_thresh , double MinT_ ,
                     const std::vector<double>& lb , const std::vector<double>& ub , unsigned int seed_ = std::random_device{}() )
       : n(pop_size) , MaxIt(max_it) , alpha(alpha_) , beta(beta_) , c1(c1_) , c2(c2_), p_threshold(p_thresh) , MinT(MinT_) 
-        , LowerBound(lb) , UpperBound(ub) , seed(seed_) , rng(seed_) {}
+        , LowerBound(lb) , UpperBound(ub) , seed(seed_) , rng(seed_) , batch_rng(seed_) {}
 };
 
 #endif // FOX_PARAMETERS_HPP
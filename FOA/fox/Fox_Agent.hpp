@@ -5,6 +5,7 @@
                
 #include "include/modules.hpp"
 #include "FOX_Parameters.hpp"    
+#include "include/fox_kernels.hpp"
 
 #include <vector>
 #include <random>
@@ -19,8 +20,9 @@
  *   - cost (double)：該離線解的 makespan（透過 Solution_Function 計算）
     
  *   - D         : 連續空間維度， = 2 * TCount （前 TCount 維用於排序鍵、後 TCount 維用於機器指派鍵）  
- *   - X         : std::vector<double> (長度 = D)，現行「連續表示」向量  
- *   - V         : std::vector<double> (長度 = D)，對應速度向量  
+ *   - X         : Aligned_Vec (長度 = D)，現行「連續表示」向量  
+ *   - V         : Aligned_Vec (長度 = D)，對應速度向量  
+ *   - X_alt / V_alt : 候選位置的緩衝，更新時寫入後與 X / V 交換指標，較差時再交換回來 (回滾不複製)  
  *   - Fitness   : double，目前以連續 X 映射離散解後的 makespan  
  *   - BestX     : std::vector<double> (長度 = D)，歷代「連續空間」最佳位置向量  
  *   - BestFitness: double，歷代最佳適應值 (makespan)  
@@ -36,15 +38,15 @@ private:
     const Config* cfg_ptr;     // 指向問題設定 (Config)
     FOX_Parameters* pars;      // 指向演算法參數
 
-    std::vector<double> X;     // 連續位置向量 (長度 = D)
-    std::vector<double> V;     // 速度向量 (長度 = D)
+    Aligned_Vec X;             // 連續位置向量 (長度 = D)
+    Aligned_Vec V;             // 速度向量 (長度 = D)
+    Aligned_Vec X_alt, V_alt;  // 候選位置 / 速度 (與 X / V 互換)
+    Aligned_Vec R1, R2;        // 整批亂數的暫存 (uniform 或 normal)
     double Fitness;            // 當前適應值 (makespan)
 
     std::vector<double> BestX; // 歷代最佳連續向量
     double BestFitness;        // 歷代最佳適應值
 
-    std::normal_distribution<double> norm_dist; // 常態分佈 N(0,1)
-
     
 public:
  
@@ -70,10 +72,11 @@ public:
 
     // 初始化位置：隨機為 X, V=0，並計算一次 Fitness, 更新 BestX, BestFitness, 及離散解 ss, ms, cost
     void initialize_position() {
-        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        const double* lb = pars->LowerBound.data();
+        const double* ub = pars->UpperBound.data();
+        pars->batch_rng.uniform(X.data(), D);
         for (int i = 0; i < D; ++i) {
-            double r = uni(pars->rng);
-            X[i] = pars->LowerBound[i] + r * (pars->UpperBound[i] - pars->LowerBound[i]);
+            X[i] = lb[i] + X[i] * (ub[i] - lb[i]);
             V[i] = 0.0;
         }
         // 計算初始適應值
@@ -105,7 +108,7 @@ public: // 計算適存值介面
         // 4. 更新歷代最佳 (愈大愈好)
         if (update && this->Fitness > this->BestFitness) {
             this->BestFitness = this->Fitness;
-            this->BestX = X;
+            this->BestX.assign(X.begin(), X.end());
             this->ss    = ss_int;
             this->ms    = ms_int;
             this->cost  = temp.cost; // res.makespan
@@ -123,122 +126,83 @@ public:
       pars(&pars_),
       X(D, 0.0),
       V(D, 0.0),
+      X_alt(D, 0.0),
+      V_alt(D, 0.0),
+      R1(D, 0.0),
+      R2(D, 0.0),
       Fitness(0.0),              
       BestX(D, 0.0),
-      BestFitness(0.0),           
-      norm_dist(0.0, 1.0)
+      BestFitness(0.0)
     {
         ss.resize(TCount_);
         ms.resize(TCount_);
     }
 
 
-    // 開發階段更新位置 (Eq.(5)/(6))：此處先示範只更新 X, V, Fitness，不回滾
+    // 開發階段更新位置 (Eq.(5)/(6))：候選位置寫入 X_alt / V_alt 後交換，較差時交換回來
     void update_position_exploitation(double p, double Dist_Fox_Prey) {
         // 1. 計算平均時間 t
-        std::uniform_real_distribution<double> uni(0.0, 1.0);
-        double sum_time = 0.0;
-        for (int j = 0; j < D; ++j) {
-            double ts = uni(pars->rng);
-            sum_time += ts;
-        }
-        double tt = sum_time / D;
+        double tt = pars->batch_rng.uniform_sum(D) / D;
         double t = tt / 2.0;
         // 2. 計算跳躍高度
         double Jump = calculate_jump(t);
 
-        // 3. 暫存舊 X, V, Fitness
-        std::vector<double> X_old = X;
-        std::vector<double> V_old = V;
+        // 3. 候選位置 (X 不動)
         double oldFitness = Fitness;
-
-        std::vector<double> X_new(D), V_new(D);
+        const double* lb = pars->LowerBound.data();
+        const double* ub = pars->UpperBound.data();
         if (p > pars->p_threshold) {
             // Eq.(5): X_new = X + Dist_Fox_Prey * Jump * c1
-            for (int i = 0; i < D; ++i) {
-                double delta = Dist_Fox_Prey * Jump * pars->c1;
-                X_new[i] = X[i] + delta;
-                // clamp
-                if (X_new[i] < pars->LowerBound[i]) X_new[i] = pars->LowerBound[i];
-                if (X_new[i] > pars->UpperBound[i]) X_new[i] = pars->UpperBound[i];
-                V_new[i] = X_new[i] - X[i];
-            }
+            Fox_Jump_Kernel(X.data(), nullptr, Dist_Fox_Prey * Jump * pars->c1, 0.0, lb, ub, X_alt.data(), V_alt.data(), D);
         } else {
             // Eq.(6): X_new = X + Dist_Fox_Prey * Jump * c2 + beta * N(0,1)
-            for (int i = 0; i < D; ++i) {
-                double delta = Dist_Fox_Prey * Jump * pars->c2;
-                double noise = pars->beta * norm_dist(pars->rng);
-                X_new[i] = X[i] + delta + noise;
-                // clamp
-                if (X_new[i] < pars->LowerBound[i]) X_new[i] = pars->LowerBound[i];
-                if (X_new[i] > pars->UpperBound[i]) X_new[i] = pars->UpperBound[i];
-                V_new[i] = X_new[i] - X[i];
-            }
+            pars->batch_rng.normal(R1.data(), D);
+            Fox_Jump_Kernel(X.data(), R1.data(), Dist_Fox_Prey * Jump * pars->c2, pars->beta, lb, ub, X_alt.data(), V_alt.data(), D);
         }
 
-        // 4. 更新 X, V
-        X = X_new;
-        V = V_new;
+        // 4. 更新 X, V (交換指標)
+        X.swap(X_alt);
+        V.swap(V_alt);
 
         // 5. 計算新適應值
         double newFitness = calculate_fitness();
 
         // 6. 如果新適應值更差 (newFitness <= oldFitness)，才回滾
         if (newFitness <= oldFitness) {
-            X = X_old;
-            V = V_old;
+            X.swap(X_alt);
+            V.swap(V_alt);
             Fitness = oldFitness;
         }
     }
 
 
-    // 探索階段更新位置 (Eq.(7)~Eq.(9))
+    // 探索階段更新位置 (Eq.(7)~Eq.(9))：候選位置寫入 X_alt 後交換，較差時交換回來
     void update_position_exploration(const std::vector<double>& BestX_current, int it) {
-        std::uniform_real_distribution<double> uni(0.0, 1.0);
-
         // 1. 計算每維 Time_ST_j，求出 tt，並更新 MinT（但設下限 0.1）
-        double sum_time = 0.0;
-        for (int j = 0; j < D; ++j) {
-            sum_time += uni(pars->rng);
-        }
-        double tt = sum_time / D;
+        double tt = pars->batch_rng.uniform_sum(D) / D;
         pars->MinT = std::max(0.1, std::min(pars->MinT, tt));  // MinT 不低於 0.1
 
         // 2. 計算 a = 2 * (1 - it/MaxIt)，若負則設 0
         double a = 2.0 * (1.0 - static_cast<double>(it) / pars->MaxIt);
         if (a < 0.0) a = 0.0;
 
-        // 3. 暫存舊 X 與舊 Fitness
-        std::vector<double> X_old = X;
+        // 3. 每個維度同時朝 BestX_current 靠近並加隨機擾動
+        //    w: 保留原 x 的權重；c3: 往 BestX_current 靠近的強度；隨機擾動規模由 MinT 與 alpha 控制
         double oldFitness = Fitness;
-
-        // 4. 針對每個維度，同時朝 BestX_current 靠近並加隨機擾動
-        for (int i = 0; i < D; ++i) {
-            double r1 = uni(pars->rng);
-            double r2 = uni(pars->rng);
-            // w: 保留原 x 的權重 (可自行設定，例如 0.7)
-            double w = 0.7;
-            // c3: 控制往 BestX_current 靠近的強度 (可自行設定，例如 1.5)
-            double c3 = 1.5;
-
-            // (a) 往 BestX_current 靠近
-            double towardsBest = w * X[i] + c3 * r1 * (BestX_current[i] - X[i]);
-            // (b) 隨機擾動 (規模由 MinT 與 alpha 控制)
-            double randomStep = pars->alpha * r2 * pars->MinT;
-            double xi = towardsBest + randomStep;
-
-            // clamp 到上下界
-            if (xi < pars->LowerBound[i]) xi = pars->LowerBound[i];
-            if (xi > pars->UpperBound[i]) xi = pars->UpperBound[i];
-            X[i] = xi;
-        }
-
-        // 5. 計算新適應值
+        const double w = 0.7;
+        const double c3 = 1.5;
+        pars->batch_rng.uniform(R1.data(), D);
+        pars->batch_rng.uniform(R2.data(), D);
+        Fox_Explore_Kernel(X.data(), BestX_current.data(), R1.data(), R2.data(), w, c3, pars->alpha * pars->MinT,
+                           pars->LowerBound.data(), pars->UpperBound.data(), X_alt.data(), D);
+        X.swap(X_alt);
+
+        // 4. 計算新適應值
         double newFitness = calculate_fitness();
 
-        // 6. 如果新適應值更差 (newFitness <= oldFitness)，則回滾
+        // 5. 如果新適應值更差 (newFitness <= oldFitness)，則回滾
         if (newFitness <= oldFitness) {
-            X = X_old;
+            X.swap(X_alt);
             Fitness = oldFitness;
         }
     }
@@ -246,15 +210,12 @@ public:
 
     // Clamp 連續向量到上下界
     void clamp_continuous() {
-        for (int i = 0; i < D; ++i) {
-            if (X[i] < pars->LowerBound[i]) X[i] = pars->LowerBound[i];
-            if (X[i] > pars->UpperBound[i]) X[i] = pars->UpperBound[i];
-        }
+        Clamp_Kernel(X.data(), pars->LowerBound.data(), pars->UpperBound.data(), D);
     }
 
     // 存取介面
-    const std::vector<double>& get_continuous_X() const { return X; }
-    const std::vector<double>& get_velocity() const { return V; }
+    const Aligned_Vec& get_continuous_X() const { return X; }
+    const Aligned_Vec& get_velocity() const { return V; }
     double get_fitness() const { return Fitness; }
     const std::vector<double>& get_best_continuous_X() const { return BestX; }
     double get_best_fitness() const { return BestFitness; }
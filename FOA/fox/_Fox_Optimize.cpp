@@ -9,6 +9,7 @@
 
 #include "Fox_Agent.hpp"
 #include "FOX_Parameters.hpp"
+#include "include/budget.hpp"
 
 
 using namespace std;
@@ -17,7 +18,9 @@ using namespace std::chrono;
 
  
 
-Solution FOX_Algorithm(const Config& cfg, FOX_Parameters& pars, vector<double>* Recorder = nullptr) {
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+Solution FOX_Algorithm(const Config& cfg, FOX_Parameters& pars, vector<double>* Recorder = nullptr, Search_Budget* budget = nullptr) {
+    if (budget) budget->start();
     int T = cfg.theTCount;
     int D = 2 * T;
     std::uniform_real_distribution<double> uni(0.0, 1.0);
@@ -42,6 +45,10 @@ Solution FOX_Algorithm(const Config& cfg, FOX_Parameters& pars, vector<double>*
         }
     }
     if (Recorder) Recorder->push_back(globalBestSol.cost); // 紀錄第0代
+    if (budget && budget->spend(globalBestSol.cost, pars.n)) {
+        budget->finish();
+        return globalBestSol;
+    }
 
     // 3. 迴圈主流程
     for (int it = 1; it <= pars.MaxIt; ++it) {
@@ -58,6 +65,8 @@ Solution FOX_Algorithm(const Config& cfg, FOX_Parameters& pars, vector<double>*
             } else {
                 foxes[i].update_position_exploration(globalBestX, it);
             }
+            // 每次位置更新評估一次；中斷後下方仍會更新全域最佳
+            if (budget && budget->spend(std::min(globalBestSol.cost, foxes[i].cost))) break;
         }
 
         // (2) 更新本代全域最佳
@@ -71,8 +80,11 @@ Solution FOX_Algorithm(const Config& cfg, FOX_Parameters& pars, vector<double>*
 
         // (3) 紀錄本代最佳 makespan
         if (Recorder) Recorder->push_back(globalBestSol.cost);
+        if (budget && budget->stopped()) break;
     }
 
+    if (budget) budget->finish();
+
     // 4. 回傳最終解
     return globalBestSol;
 }
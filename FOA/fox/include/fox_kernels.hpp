@@ -0,0 +1,153 @@
+#ifndef FOX_KERNELS_HPP
+#define FOX_KERNELS_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <new>
+
+// Continuous FOX Kernels
+// X / V 與暫存亂數放在 64-byte 對齊的緩衝；kernel 都是單一、無分支、無 aliasing (__restrict) 的迴圈，
+// clamp 寫成 select，編譯器可直接向量化 (GCC -O3，或 -O2 -ftree-vectorize；不需要指定 ISA 的 intrinsics)。
+// 亂數整批產生：counter-based SplitMix64，第 k 個值只由 (key, counter + k) 決定、元素之間沒有相依，
+// 整批迴圈可向量化；常態亂數以 Box-Muller 成對轉換
+
+
+// ----- Aligned Buffer ------
+template <typename T, size_t Align = 64>
+struct Aligned_Allocator {
+    typedef T value_type;
+    template <typename U> struct rebind { typedef Aligned_Allocator<U, Align> other; };
+
+    Aligned_Allocator() noexcept {}
+    template <typename U> Aligned_Allocator(const Aligned_Allocator<U, Align>&) noexcept {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Align)));
+    }
+    void deallocate(T* p, size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Align));
+    }
+};
+
+template <typename T, typename U, size_t A>
+bool operator==(const Aligned_Allocator<T, A>&, const Aligned_Allocator<U, A>&) { return true; }
+template <typename T, typename U, size_t A>
+bool operator!=(const Aligned_Allocator<T, A>&, const Aligned_Allocator<U, A>&) { return false; }
+
+// 對齊的 double 向量 (swap 只交換指標)
+typedef std::vector<double, Aligned_Allocator<double>> Aligned_Vec;
+
+
+
+
+// ----- Batch RNG ------
+class Batch_RNG {
+public:
+    explicit Batch_RNG(uint64_t seed = 0) { this->seed(seed); }
+
+    void seed(uint64_t s) {
+        key_ = mix(s + 0x9E3779B97F4A7C15ULL);
+        counter_ = 0;
+    }
+
+    // out[0, n) ~ U[0, 1)
+    void uniform(double* __restrict out, int n) {
+        const uint64_t key = key_, base = counter_;
+        for (int i = 0; i < n; ++i)
+            out[i] = to_unit(mix(key + (base + (uint64_t)i + 1) * 0x9E3779B97F4A7C15ULL));
+        counter_ += n;
+    }
+
+    // n 個 U[0, 1) 的總和 (只需要平均時不必寫出)
+    double uniform_sum(int n) {
+        const uint64_t key = key_, base = counter_;
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i)
+            sum += to_unit(mix(key + (base + (uint64_t)i + 1) * 0x9E3779B97F4A7C15ULL));
+        counter_ += n;
+        return sum;
+    }
+
+    // out[0, n) ~ N(0, 1)：先寫入 uniform，再兩兩以 Box-Muller 原地轉換
+    void normal(double* __restrict out, int n) {
+        int even = n & ~1;
+        uniform(out, even);
+        const double two_pi = 6.283185307179586;
+        for (int i = 0; i < even; i += 2) {
+            double r  = std::sqrt(-2.0 * std::log(1.0 - out[i]));
+            double th = two_pi * out[i + 1];
+            out[i]     = r * std::cos(th);
+            out[i + 1] = r * std::sin(th);
+        }
+        if (n & 1) {
+            double u[2];
+            uniform(u, 2);
+            out[n - 1] = std::sqrt(-2.0 * std::log(1.0 - u[0])) * std::cos(two_pi * u[1]);
+        }
+    }
+
+private:
+    static uint64_t mix(uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+    static double to_unit(uint64_t x) { return (double)(x >> 11) * (1.0 / 9007199254740992.0); }
+
+    uint64_t key_ = 0;
+    uint64_t counter_ = 0;
+};
+
+
+
+
+// ----- Position Kernels ------
+// clamp 到 [lo, hi] (先下界再上界，與原本的兩個 if 相同)
+inline void Clamp_Kernel(double* __restrict x, const double* __restrict lo, const double* __restrict hi, int n) {
+    for (int i = 0; i < n; ++i) {
+        double v = x[i];
+        v = v < lo[i] ? lo[i] : v;
+        x[i] = v > hi[i] ? hi[i] : v;
+    }
+}
+
+// Eq.(5) / (6)：x_new = clamp(x + shift [+ scale * noise], lo, hi)，v_new = x_new - x
+// noise 為 nullptr 時不加擾動
+inline void Fox_Jump_Kernel(const double* __restrict x, const double* __restrict noise, double shift, double scale,
+                            const double* __restrict lo, const double* __restrict hi,
+                            double* __restrict x_new, double* __restrict v_new, int n) {
+    if (noise) {
+        for (int i = 0; i < n; ++i) {
+            double v = x[i] + shift + scale * noise[i];
+            v = v < lo[i] ? lo[i] : v;
+            v = v > hi[i] ? hi[i] : v;
+            x_new[i] = v;
+            v_new[i] = v - x[i];
+        }
+    } else {
+        for (int i = 0; i < n; ++i) {
+            double v = x[i] + shift;
+            v = v < lo[i] ? lo[i] : v;
+            v = v > hi[i] ? hi[i] : v;
+            x_new[i] = v;
+            v_new[i] = v - x[i];
+        }
+    }
+}
+
+// 探索：x_new = clamp(w * x + c3 * r1 * (best - x) + step * r2, lo, hi)
+inline void Fox_Explore_Kernel(const double* __restrict x, const double* __restrict best,
+                               const double* __restrict r1, const double* __restrict r2,
+                               double w, double c3, double step,
+                               const double* __restrict lo, const double* __restrict hi,
+                               double* __restrict x_new, int n) {
+    for (int i = 0; i < n; ++i) {
+        double v = w * x[i] + c3 * r1[i] * (best[i] - x[i]) + step * r2[i];
+        v = v < lo[i] ? lo[i] : v;
+        x_new[i] = v > hi[i] ? hi[i] : v;
+    }
+}
+
+#endif
@@ -3,54 +3,135 @@
 #define DISCRETE_FOX_AGENT_HPP
 
 #include "include/modules.hpp"
+#include "include/population_arena.hpp"
  
 #include <vector>
 #include <random>
 #include <algorithm>
 #include <limits>
 
+// 一隻狐狸的排程狀態：解本身 + 由最後一次評估 (ScheduleResult) 推得的資料
+// 每隻狐狸有兩份 (目前 / 候選)，更新都寫在候選上，接受時交換 index，回滾不需要複製
+struct Fox_Schedule_State {
+    Solution sol;                               // ss (Solution_Function 修正後) / ms / cost
+    std::vector<int> pos;                       // task -> 在 ss 中的位置 (反排列)
+    std::vector<double> load;                   // 各處理器的完成時間
+    std::vector<std::vector<int>> proc_tasks;   // 各處理器上的任務 (依執行順序)
+
+    void resize(int T, int P) {
+        sol.ss.resize(T);
+        sol.ms.resize(T);
+        sol.cost = std::numeric_limits<double>::infinity();
+        pos.resize(T);
+        load.assign(P, 0.0);
+        proc_tasks.resize(P);
+    }
+
+    // 候選從目前狀態開始 (assign 重複使用記憶體)
+    void copy_solution(const Fox_Schedule_State& from) {
+        sol.ss = from.sol.ss;
+        sol.ms = from.sol.ms;
+        sol.cost = from.sol.cost;
+        pos = from.pos;
+    }
+
+    void swap_tasks(int i, int j) {
+        std::swap(sol.ss[i], sol.ss[j]);
+        pos[sol.ss[i]] = i;
+        pos[sol.ss[j]] = j;
+    }
+
+    // 評估 sol (原地修正 ss)，並由結果重建 pos / load / proc_tasks
+    double evaluate(const Config& cfg) {
+        ScheduleResult res = Solution_Function(sol, cfg);
+        int T = sol.ss.size();
+        std::fill(load.begin(), load.end(), 0.0);
+        for (auto& list : proc_tasks) list.clear();
+        for (int i = 0; i < T; ++i) {
+            int t = sol.ss[i];
+            int p = sol.ms[t];
+            pos[t] = i;
+            proc_tasks[p].push_back(t);
+            load[p] = std::max(load[p], res.endTime[t]);
+        }
+        sol.cost = res.makespan;
+        return sol.cost;
+    }
+};
+
+
 class DiscreteFoxAgent {
 private:
     int id;                      // 狐狸編號
     int TCount;                  // 任務數量 (從 Config.theTCount 取得)
     const Config* cfg_ptr;       // 指向全域問題設定
-    // 目前解 (離散)
-    std::vector<int> ss;         // 任務執行順序 (長度 = TCount)
-    std::vector<int> ms;         // 每個任務對應機器 (長度 = TCount)
-    double cost;                 // 目前 makespan
-    double Fitness;              // 目前適應度 = 1.0 / cost
-    // 這隻狐狸的歷代最佳解 (Per‐Agent Elite)
-    std::vector<int> best_ss;
-    std::vector<int> best_ms;
-    double best_cost;
+    // 目前解 / 候選解 (雙緩衝)：state[cur] 為目前解
+    Fox_Schedule_State state[2];
+    int cur;
+    // 這隻狐狸的歷代最佳解 (Per‐Agent Elite)：放在引擎的 Population_Arena 中 (全部狐狸的 elite 連續存放)
+    Row best_ss;
+    Row best_ms;
+    double* best_cost;
     double best_Fitness;
 
-    // 隨機引擎 (共用外部 rng)
-    std::mt19937& rng;
+    // 每隻狐狸自己的隨機引擎 (種子由呼叫端衍生，狐狸之間不共用狀態，可平行更新)
+    std::mt19937 rng;
     std::uniform_real_distribution<double> uni01; // [0,1)
 
+    Fox_Schedule_State& current()   { return state[cur]; }
+    Fox_Schedule_State& candidate() { return state[cur ^ 1]; }
+    const Fox_Schedule_State& current() const { return state[cur]; }
+
+    // 候選從目前解開始
+    Fox_Schedule_State& begin_candidate() {
+        candidate().copy_solution(current());
+        return candidate();
+    }
+
+    // 評估候選；比目前解好 (或 force) 就交換成目前解，否則目前解保持不變 (回滾)
+    // 回傳是否接受
+    bool finish_candidate(bool force = false) {
+        double c = candidate().evaluate(*cfg_ptr);
+        if (!force && !(c < current().sol.cost)) return false;
+        cur ^= 1;
+        return true;
+    }
+
+    static double fitness_of(double c) { return 1.0 / (c + 1e-9); } // 避免除以 0
+
 public:
-    DiscreteFoxAgent(int id_, const Config& cfg, std::mt19937& rng_)
+    // elite：這隻狐狸在 arena 中的 slot (arena 須以 theTCount 配置好，且活得比狐狸久)
+    DiscreteFoxAgent(int id_, const Config& cfg, unsigned int seed, Member_View elite)
         : id(id_),
           TCount(static_cast<int>(cfg.theTCount)),
           cfg_ptr(&cfg),
-          cost(std::numeric_limits<double>::infinity()),
-          Fitness(0.0),
-          best_cost(std::numeric_limits<double>::infinity()),
+          cur(0),
+          best_ss(elite.ss),
+          best_ms(elite.ms),
+          best_cost(elite.cost),
           best_Fitness(0.0),
-          rng(rng_),
+          rng(seed),
           uni01(0.0, 1.0)
     {
-        ss.resize(TCount);
-        ms.resize(TCount);
-        best_ss.resize(TCount);
-        best_ms.resize(TCount);
+        int PCount = static_cast<int>(cfg.thePCount);
+        state[0].resize(TCount, PCount);
+        state[1].resize(TCount, PCount);
+        *best_cost = std::numeric_limits<double>::infinity();
     }
 
     // =========================
-    // 1. 隨機初始化離散解
+    // 1. 隨機初始化離散解 (seed 不為 nullptr 時直接從該解開始)
     // =========================
-    void initialize() {
+    void initialize(const Solution* seed = nullptr) {
+        std::vector<int>& ss = current().sol.ss;
+        std::vector<int>& ms = current().sol.ms;
+        if (seed) {
+            ss = seed->ss;
+            ms = seed->ms;
+            current().evaluate(*cfg_ptr);
+            update_best();
+            return;
+        }
         // 1.1 隨機產生一個排列 ss = {0,1,2,...,TCount-1} 的亂序
         for (int i = 0; i < TCount; ++i) ss[i] = i;
         std::shuffle(ss.begin(), ss.end(), rng);
@@ -61,30 +142,21 @@ public:
             ms[i] = uniMach(rng);
         }
         // 1.3 計算一次 cost/Fitness，並更新歷代最佳
-        calculate_fitness(true);
+        current().evaluate(*cfg_ptr);
+        update_best();
     }
 
     // =========================
-    // 2. 計算適應值 (makespan & Fitness)
-    //    若 update_best=true，則同時更新 best_* 
+    // 2. 更新歷代最佳 (以目前解)
     // =========================
-    double calculate_fitness(bool update_best = false) {
-        // 2.1 用當前 ss, ms 計算 schedule
-        Solution sol;
-        sol.ss = ss;
-        sol.ms = ms;
-        ScheduleResult res = Solution_Function(sol, *cfg_ptr);
-        cost = res.makespan;
-        Fitness = 1.0 / (cost + 1e-9); // 避免除以 0
-
-        // 2.2 更新歷代最佳
-        if (update_best && cost < best_cost) {
-            best_cost = cost;
-            best_Fitness = Fitness;
-            best_ss = ss;
-            best_ms = ms;
+    void update_best() {
+        const Solution& sol = current().sol;
+        if (sol.cost < *best_cost) {
+            *best_cost = sol.cost;
+            best_Fitness = fitness_of(sol.cost);
+            best_ss.copy_from(sol.ss);
+            best_ms.copy_from(sol.ms);
         }
-        return Fitness;
     }
 
     // =========================
@@ -92,6 +164,8 @@ public:
     //    距離 = alpha * Hamming(ss, best_ss) + beta * Hamming(ms, best_ms)
     // =========================
     double distance_to_best(double alpha, double beta) const {
+        const std::vector<int>& ss = current().sol.ss;
+        const std::vector<int>& ms = current().sol.ms;
         int diff_seq = 0;
         for (int k = 0; k < TCount; ++k) {
             if (ss[k] != best_ss[k]) diff_seq++;
@@ -109,10 +183,10 @@ public:
     //    構想：執行 numExplorationSwaps 次 swap/reverse；執行 numExplorationReassign 次隨機重分配
     // =========================
     void update_exploration(int numExplorationSwaps, int numExplorationReassign) {
-        // 保存舊解
-        auto old_ss = ss;
-        auto old_ms = ms;
-        double old_cost = cost;
+        // 在候選上擾動 (目前解不動)
+        Fox_Schedule_State& cand = begin_candidate();
+        std::vector<int>& ss = cand.sol.ss;
+        std::vector<int>& ms = cand.sol.ms;
 
         // (A) 隨機擾動 ss
         std::uniform_int_distribution<int> uniIdx(0, TCount - 1);
@@ -140,14 +214,8 @@ public:
             ms[t] = uniMach(rng);
         }
 
-        // (C) 計算新適應，如果沒有改善就回滾
-        double newFit = calculate_fitness(false);
-        if (newFit <= 1.0 / (old_cost + 1e-9)) {
-            ss = old_ss;
-            ms = old_ms;
-            cost = old_cost;
-            Fitness = 1.0 / (cost + 1e-9);
-        }
+        // (C) 計算新適應，如果沒有改善就保留目前解 (回滾)
+        finish_candidate();
     }
 
     // =========================
@@ -162,10 +230,10 @@ public:
     void update_exploitation(double p1, double p2, double pPerturb,
                              double pLocalSwap, double pLocalReverse, double pLocalReassign) 
     {
-        // 保存舊解
-        auto old_ss = ss;
-        auto old_ms = ms;
-        double old_cost = cost;
+        // 在候選上修改 (目前解不動)
+        Fox_Schedule_State& cand = begin_candidate();
+        std::vector<int>& ss = cand.sol.ss;
+        std::vector<int>& ms = cand.sol.ms;
 
         // 決定 c1 或 c2
         double z = uni01(rng);
@@ -176,14 +244,14 @@ public:
                 if (ss[k] != best_ss[k]) {
                     double z2 = uni01(rng);
                     if (z2 < p1) {
-                        // 對齊到 best
-                        ss[k] = best_ss[k];
+                        // 對齊到 best：與 best_ss[k] 目前所在的位置交換 (保持排列)
+                        cand.swap_tasks(k, cand.pos[best_ss[k]]);
                     } else {
                         double z3 = uni01(rng);
                         if (z3 < pPerturb) {
                             // 小範圍 swap：與相鄰一位交換
-                            if (k < TCount - 1) std::swap(ss[k], ss[k + 1]);
-                            else std::swap(ss[k], ss[k - 1]);
+                            if (k < TCount - 1) cand.swap_tasks(k, k + 1);
+                            else cand.swap_tasks(k, k - 1);
                         }
                     }
                 }
@@ -223,37 +291,42 @@ public:
             // (B) ms 的負載再平衡
             double z8 = uni01(rng);
             if (z8 < pLocalReassign) {
-                // 找出機器負載最重者
+                // 最重的機器上隨機一個任務，與最輕機器上的一個任務交換指派 (最輕機器沒有任務時直接搬過去)；
+                // 負載與各機器的任務列表取自目前解最後一次評估的結果，不重新模擬
                 int heavy = find_heavy_machine();
-                auto tasksOnHeavy = tasks_of_machine(heavy);
-                if (static_cast<int>(tasksOnHeavy.size()) >= 2) {
-                    std::uniform_int_distribution<int> uniIdx(0, static_cast<int>(tasksOnHeavy.size()) - 2);
-                    int pos = uniIdx(rng);
-                    int t1 = tasksOnHeavy[pos];
-                    int t2 = tasksOnHeavy[pos + 1];
-                    std::swap(ms[t1], ms[t2]);
+                int light = find_light_machine();
+                const std::vector<int>& tasksOnHeavy = tasks_of_machine(heavy);
+                const std::vector<int>& tasksOnLight = tasks_of_machine(light);
+                if (heavy != light && !tasksOnHeavy.empty()) {
+                    std::uniform_int_distribution<int> uniH(0, static_cast<int>(tasksOnHeavy.size()) - 1);
+                    int t1 = tasksOnHeavy[uniH(rng)];
+                    if (!tasksOnLight.empty()) {
+                        std::uniform_int_distribution<int> uniL(0, static_cast<int>(tasksOnLight.size()) - 1);
+                        int t2 = tasksOnLight[uniL(rng)];
+                        std::swap(ms[t1], ms[t2]);
+                    } else {
+                        ms[t1] = light;
+                    }
                 }
             }
         }
 
-        // 計算新適應，若沒有改善就回滾
-        double newFit = calculate_fitness(false);
-        if (newFit <= 1.0 / (old_cost + 1e-9)) {
-            ss = old_ss;
-            ms = old_ms;
-            cost = old_cost;
-            Fitness = 1.0 / (cost + 1e-9);
-        }
+        // 計算新適應，若沒有改善就保留目前解 (回滾)
+        finish_candidate();
     }
 
     // =========================
     // 6. 跳躍機制 (Jump)
     //    若連續 noImproveCounter >= T_noImprove，就觸發全重置或部分重置
     // =========================
-    void update_jump(int noImproveCounter, int T_noImprove, double pJump) {
+    //    回傳是否真的跳躍 (跳躍會多評估一次)
+    bool update_jump(int noImproveCounter, int T_noImprove, double pJump) {
         if (noImproveCounter >= T_noImprove) {
             double z = uni01(rng);
             if (z < pJump) {
+                Fox_Schedule_State& cand = begin_candidate();
+                std::vector<int>& ss = cand.sol.ss;
+                std::vector<int>& ms = cand.sol.ms;
                 double z2 = uni01(rng);
                 if (z2 < 0.5) {
                     // 全重置：重新隨機產生 ss, ms
@@ -279,72 +352,48 @@ public:
                         ms[t] = uniMach(rng);
                     }
                 }
-                // 跳躍後更新適應度
-                calculate_fitness(false);
+                // 跳躍後更新適應度 (不論好壞都接受)
+                finish_candidate(true);
+                return true;
             }
         }
+        return false;
     }
 
     // =========================
-    // 輔助函式：找到負載最重的機器
-    //    先基於當前 ss, ms 計算各機器上的累積加工完成時間 (procFree)
+    // 輔助函式：負載最重 / 最輕的機器
+    //    負載為目前解最後一次評估時各處理器的完成時間
     // =========================
     int find_heavy_machine() const {
-        int P = static_cast<int>(cfg_ptr->thePCount);
-        std::vector<double> procFree(P, 0.0);
-        // 先模擬已有排程，只需考慮 ms, ss 的順序
-        std::vector<double> startT(TCount, 0.0), endT(TCount, 0.0);
-        for (int idx = 0; idx < TCount; ++idx) {
-            int t = ss[idx];
-            int p = ms[t];
-            double ready = 0.0;
-            auto it = cfg_ptr->predMap.find(t);
-            if (it != cfg_ptr->predMap.end()) {
-                for (auto &pr : it->second) {
-                    int from = pr.first;
-                    double vol = pr.second;
-                    int pf = ms[from];
-                    double commDelay = (pf != p) ? (vol * cfg_ptr->theCommRate[pf][p]) : 0.0;
-                    ready = std::max(ready, endT[from] + commDelay);
-                }
-            }
-            startT[t] = std::max(ready, procFree[p]);
-            endT[t] = startT[t] + cfg_ptr->theCompCost[t][p];
-            procFree[p] = endT[t];
-        }
-        // 找最大 procFree
-        int heavy = 0;
-        double maxLoad = procFree[0];
-        for (int i = 1; i < P; ++i) {
-            if (procFree[i] > maxLoad) {
-                maxLoad = procFree[i];
-                heavy = i;
-            }
-        }
-        return heavy;
+        const std::vector<double>& load = current().load;
+        return std::max_element(load.begin(), load.end()) - load.begin();
+    }
+
+    int find_light_machine() const {
+        const std::vector<double>& load = current().load;
+        return std::min_element(load.begin(), load.end()) - load.begin();
     }
 
     // =========================
-    // 輔助函式：回傳當前被指派到 machine m 的任務列表
+    // 輔助函式：目前被指派到 machine m 的任務列表 (依執行順序)
     // =========================
-    std::vector<int> tasks_of_machine(int m) const {
-        std::vector<int> list;
-        for (int t = 0; t < TCount; ++t) {
-            if (ms[t] == m) list.push_back(t);
-        }
-        return list;
+    const std::vector<int>& tasks_of_machine(int m) const {
+        return current().proc_tasks[m];
     }
 
+    // 這隻狐狸的亂數 U[0,1) (例如決定探索 / 開發)
+    double random01() { return uni01(rng); }
+
     // =========================
     // Getter / Setter
     // =========================
-    const std::vector<int>& get_ss()     const { return ss; }
-    const std::vector<int>& get_ms()     const { return ms; }
-    double get_cost()                    const { return cost; }
-    double get_Fitness()                 const { return Fitness; }
-    const std::vector<int>& get_best_ss()const { return best_ss; }
-    const std::vector<int>& get_best_ms()const { return best_ms; }
-    double get_best_cost()               const { return best_cost; }
+    const std::vector<int>& get_ss()     const { return current().sol.ss; }
+    const std::vector<int>& get_ms()     const { return current().sol.ms; }
+    double get_cost()                    const { return current().sol.cost; }
+    double get_Fitness()                 const { return fitness_of(current().sol.cost); }
+    Row get_best_ss()                    const { return best_ss; }
+    Row get_best_ms()                    const { return best_ms; }
+    double get_best_cost()               const { return *best_cost; }
     double get_best_Fitness()            const { return best_Fitness; }
 };
 
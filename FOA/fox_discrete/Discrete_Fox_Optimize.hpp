@@ -0,0 +1,176 @@
+#ifndef DISCRETE_FOX_OPTIMIZE_HPP
+#define DISCRETE_FOX_OPTIMIZE_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/thread_pool.hpp"
+#include "Discrete_Fox_Agent.hpp"
+#include "FOX_Parameters.hpp"
+
+#include <vector>
+#include <atomic>
+#include <random>
+#include <memory>
+#include <algorithm>
+
+// Discrete FOX Engine
+// 每隻狐狸有自己的 mt19937 (種子由 params.seed 經 seed_seq 衍生)，一次迭代中各狐狸只讀寫自己的狀態，
+// 所以整批更新可以丟給 thread pool；迭代最佳以 lock-free 的 CAS 歸約 (cost 相同取 index 小者)，
+// 結果與執行緒數、排程順序無關 (相同 seed 結果相同)
+// 各狐狸的歷代最佳 (ss / ms / cost) 放在同一個 Population_Arena (SoA，連續記憶體)，迭代中不再配置
+
+
+// 把 [0, n) 切成 pool->size() 段並行執行 body(i)，pool 為 nullptr 或只有一條執行緒時逐一執行
+template <typename Body>
+inline void Parallel_For(int n, Work_Stealing_Pool* pool, const Body& body) {
+    if (!pool || pool->size() <= 1 || n < 2) {
+        for (int i = 0; i < n; ++i) body(i);
+        return;
+    }
+    int chunks = std::min<int>(pool->size(), n);
+    for (int c = 0; c < chunks; ++c) {
+        int lo = (long long)n * c / chunks, hi = (long long)n * (c + 1) / chunks;
+        pool->submit([&body, lo, hi]{
+            for (int i = lo; i < hi; ++i) body(i);
+        });
+    }
+    pool->wait_idle();
+}
+
+
+// 迭代最佳的 lock-free 歸約：cost[i] 先寫好，再以 CAS 把 index 換成 (cost, index) 較小者
+// (release / acquire 保證讀到別人發布的 cost[j])
+class Best_Reduction {
+public:
+    explicit Best_Reduction(const std::vector<double>& cost) : cost_(cost), best_(-1) {}
+
+    void reset() { best_.store(-1, std::memory_order_relaxed); }
+
+    void offer(int i) {
+        int seen = best_.load(std::memory_order_acquire);
+        while (seen < 0 || cost_[i] < cost_[seen] || (cost_[i] == cost_[seen] && i < seen)) {
+            if (best_.compare_exchange_weak(seen, i, std::memory_order_acq_rel, std::memory_order_acquire)) return;
+        }
+    }
+
+    int best() const { return best_.load(std::memory_order_acquire); }
+
+private:
+    const std::vector<double>& cost_;
+    std::atomic<int> best_;
+};
+
+
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// (評估次數上限在迭代邊界檢查)；全局最佳連續 T_noImprove 代沒變時提前結束 (Stop_Reason::NO_IMPROVE)
+Solution Discrete_FOX_Optimize(const Config& cfg, const FOX_Parameters& params,
+                               vector<double>* Recorder = nullptr, Search_Budget* budget = nullptr)
+{
+    if (budget) budget->start();
+    int N = std::max(1, params.P);
+
+    // 1. 各狐狸的種子與初始化
+    std::seed_seq seq{params.seed};
+    std::vector<unsigned int> seeds(N);
+    seq.generate(seeds.begin(), seeds.end());
+
+    Population_Arena elites(N, cfg.theTCount);     // 各狐狸的歷代最佳
+    std::vector<DiscreteFoxAgent> foxes;
+    foxes.reserve(N);
+    for (int i = 0; i < N; ++i) foxes.emplace_back(i, cfg, seeds[i], elites.view(i));
+
+    std::unique_ptr<Work_Stealing_Pool> pool;
+    if (params.num_threads != 1) pool.reset(new Work_Stealing_Pool(params.num_threads));
+
+    std::vector<double> cost(N);            // 本次迭代各狐狸的 cost (歸約用)
+    std::vector<int> evals(N, 0);           // 本次迭代各狐狸的評估數
+    std::vector<int> noImproveCount(N, 0);
+    Best_Reduction reduction(cost);
+
+    // use_Heuristic：狐狸 0 從 HEFT 解開始 (主執行緒先算好)
+    Solution heft;
+    if (params.use_Heuristic) heft = HEFT_Solution(cfg);
+    Parallel_For(N, pool.get(), [&](int i) {
+        foxes[i].initialize(params.use_Heuristic && i == 0 ? &heft : nullptr);
+        cost[i] = foxes[i].get_cost();
+        reduction.offer(i);
+    });
+
+    // 2. 初始全局最佳
+    Solution globalBest;
+    // (初始化後每隻狐狸的目前解就是牠的 elite)
+    int b = reduction.best();
+    elites.store(b, globalBest);
+    if (Recorder) Recorder->push_back(globalBest.cost);
+    if (budget && budget->spend(globalBest.cost, N)) {
+        budget->finish();
+        return globalBest;
+    }
+
+    // 3. 主迴圈
+    int globalNoImprove = 0;
+    for (int t = 1; t <= params.MaxIt; ++t) {
+        // (A) 探索率與開發的靠攏機率 (線性衰減)
+        double p_explore = 1.0 - static_cast<double>(t) / params.MaxIt;
+        double p1 = 0.9 * p_explore + 0.1;
+        double p2 = 0.7 * p_explore + 0.1;
+
+        // 評估次數上限：只更新前 active 隻 (跳躍可能多用一次評估)
+        int active = N;
+        if (budget && budget->max_evals > 0)
+            active = (int)std::max(0LL, std::min<long long>(N, budget->max_evals - budget->evals));
+
+        // (B) 各狐狸平行更新，只動自己的狀態
+        reduction.reset();
+        Parallel_For(active, pool.get(), [&](int i) {
+            DiscreteFoxAgent& fox = foxes[i];
+            if (fox.random01() < p_explore) {
+                fox.update_exploration(params.numExplorationSwaps, params.numExplorationReassign);
+            } else {
+                fox.update_exploitation(p1, p2, params.pPerturb,
+                                        params.pLocalSwap, params.pLocalReverse, params.pLocalReassign);
+            }
+            bool jumped = fox.update_jump(noImproveCount[i], params.T_noImprove, params.pJump);
+
+            // 比自己的歷代最佳好就更新，並重置 noImproveCount
+            if (fox.get_cost() < fox.get_best_cost()) {
+                fox.update_best();
+                noImproveCount[i] = 0;
+            } else {
+                noImproveCount[i]++;
+            }
+
+            evals[i] = jumped ? 2 : 1;
+            cost[i] = fox.get_cost();
+            reduction.offer(i);
+        });
+
+        // (C) 更新全局最佳 (主執行緒)
+        // 比全局最佳好的狐狸在 (B) 已經更新過 elite，直接從 arena 複製
+        b = reduction.best();
+        if (b >= 0 && cost[b] < globalBest.cost) {
+            elites.store(b, globalBest);
+            globalNoImprove = 0;
+        } else {
+            globalNoImprove++;
+        }
+        if (Recorder) Recorder->push_back(globalBest.cost);
+
+        if (budget) {
+            bool stop = false;
+            for (int i = 0; i < active; ++i) stop = budget->spend(globalBest.cost, evals[i]);
+            if (stop || active < N) break;
+        }
+
+        // (D) 提前終止：全局最優連續 T_noImprove 代沒變
+        if (globalNoImprove >= params.T_noImprove) {
+            if (budget) budget->finish(Stop_Reason::NO_IMPROVE);
+            break;
+        }
+    }
+
+    if (budget) budget->finish();
+    return globalBest;
+}
+
+#endif
@@ -5,7 +5,8 @@
 #include <random>
 
 struct FOX_Parameters {
-    std::mt19937 rng;           // 隨機引擎
+    unsigned int seed;          // 隨機種子 (各狐狸的亂數 stream 由此衍生)
+    unsigned int num_threads;   // 平行更新的執行緒數 (0 = hardware_concurrency，1 = 不開執行緒)
 
     // ---- 探索模式相關 ----
     int numExplorationSwaps;    // 每次探索時對 ss 做 swap/reverse 的次數 (建議 1~3)
@@ -30,9 +31,11 @@ struct FOX_Parameters {
     // ---- 演算法全域參數 ----
     int MaxIt;                  // 最大迭代次數
     int P;                      // 狐狸群族大小
+    bool use_Heuristic;         // true：第一隻狐狸以 HEFT 解初始化 (見 include/heft.hpp)，其餘隨機
 
     FOX_Parameters()
-    : rng(std::random_device{}()),
+    : seed(std::random_device{}()),
+      num_threads(0),
       numExplorationSwaps(2),
       numExplorationReassign(2),
       pPerturb(0.15),
@@ -44,7 +47,8 @@ struct FOX_Parameters {
       T_noImprove(20),
       pJump(0.1),
       MaxIt(1000),
-      P(30)
+      P(30),
+      use_Heuristic(false)
     {}
 };
 
@@ -1,6 +1,14 @@
 #ifndef IDVIDUAL_HPP
-#define IDEVIUAL_HPP
+#define IDVIDUAL_HPP
 #include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/thread_pool.hpp"
+#include "include/indexed_heap.hpp"
+#include "include/sampling.hpp"
+#include "include/crossover.hpp"
+#include "include/diversity.hpp"
+#include "include/population_arena.hpp"
+#include <memory>
 
 
 
@@ -11,13 +19,30 @@ struct GA_Params {
     double crossover_rate;
     double mutation_rate;
     std::string selection_method;
+    bool generational;          // false: 穩態 (原本的逐一替換)、true: 世代式 (μ+λ) 批次評估
+    int offspring_size;         // 世代式每代的小孩數 λ，<= 0 則等於 population_size
+    std::string replacement;    // 世代式的替換方式
+    int elite_count;            // replacement = "e" 時保留的父代精英數
+    int num_threads;            // 批次評估的執行緒數，0 = hardware_concurrency
+    double rank_pressure;       // 排名式選擇的線性選擇壓力 (1.0 ~ 2.0)
+    Crossover_Lib::SS_Crossover ss_crossover;   // ss 的交配算子 (見 include/crossover.hpp)
+    Diversity_Params diversity;                 // 複製品拒絕與多樣性觸發的移民 (見 include/diversity.hpp)
+    bool use_Heuristic;         // true：族群的第一個個體用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 
     GA_Params(){
         population_size = 50;
         generations = 200;
         crossover_rate = 0.7;
         mutation_rate = 0.4;
-        selection_method = "t"; //  鍛造式選擇 t 、 輪盤式 r
+        selection_method = "t"; //  鍛造式選擇 t 、 輪盤式 r 、 排名式 k 、 隨機普遍抽樣 s (SUS)
+        generational = false;
+        offspring_size = 0;
+        replacement = "p";      //  (μ+λ) 截斷 p 、 精英保留 e (小孩取代父代，只留 elite_count 個父代)
+        elite_count = 2;
+        num_threads = 0;
+        rank_pressure = 1.5;
+        ss_crossover = Crossover_Lib::SS_Crossover::OX;     // 原本的算子；IPOX 保留父代的拓撲前綴，修正少很多
+        use_Heuristic = false;
     }
 };
 
@@ -25,57 +50,47 @@ struct GA_Params {
 
 
 
+// fitness = 1 / cost (選擇用；族群 arena 只存 cost，需要時由 cost 算)
+inline double Fitness_Of(double cost) { return 1.0 / (cost + 1e-9); }
+
+
 // Individual 
+// (以 vector 為主的個體 API；Genetic_Algorithm_2 與 Island GA 的族群放在 Population_Arena，見 Breed_Member)
 class Individual : public Solution {
 public:
     double fitness;  
 
     Individual() = default;
-    Individual(const Config& cfg) {
-        Solution init = GenerateInitialSolution(cfg);
+    Individual(const Config& cfg, bool useHeuristic = false) {
+        Solution init = GenerateInitialSolution(cfg, useHeuristic);
         this->ss = std::move(init.ss);
         this->ms = std::move(init.ms);
         evaluate(cfg);
     }
 
-    //  Mating
-    Individual crossover( Individual& other, Config& cfg , double crossover_rate) const {
+    //  Mating (evaluate = false 時不評估小孩，交給批次評估)
+    //  ss 由 Crossover_Lib 的算子寫入 child.ss (暫存空間為每條執行緒共用，不另外配置)
+    Individual crossover( const Individual& other, const Config& cfg , double crossover_rate, bool evaluate = true,
+                          Crossover_Lib::SS_Crossover op = Crossover_Lib::SS_Crossover::OX) const {
+        Individual child;
+        crossover_into(other, cfg, crossover_rate, child, evaluate, op);
+        return child;
+    }
+
+    //  同 crossover，但寫入既有的 child (重複使用 child 的 ss / ms 記憶體)
+    void crossover_into( const Individual& other, const Config& cfg , double crossover_rate, Individual& child,
+                         bool evaluate = true, Crossover_Lib::SS_Crossover op = Crossover_Lib::SS_Crossover::OX) const {
         int T = cfg.theTCount;
-        int P = cfg.thePCount;
         std::uniform_real_distribution<double> uni_rnd(0.0, 1.0);
-        std::uniform_int_distribution<int> cutDist(0, T-1);
 
-        Individual child = *this;  
+        child = *this;  
 
-        //  OX for ss
         if (uni_rnd(rng) < crossover_rate) {
-            int c1 = cutDist(rng), c2 = cutDist(rng);
-            if (c1 > c2) std::swap(c1, c2);
-
-            // Child Generate Schedule String 
-            std::vector<int> new_ss(T, -1);
-            std::vector<bool> used(T, false);
-
-             
-            for (int i = c1; i <= c2; ++i) {
-                new_ss[i] = ss[i];
-                used[ss[i]] = true;
-            }
-            //  other.ss  Fill empty Gene
-            int idx = (c2 + 1) % T;
-            for (int k = 0; k < T; ++k) {
-                int gene = other.ss[(c2 + 1 + k) % T];
-                if (!used[gene]) {
-                    new_ss[idx]    = gene;
-                    used[gene]     = true;
-                    idx            = (idx + 1) % T;
-                }
-            }
-            child.ss = std::move(new_ss);
+            Crossover_Lib::Crossover_SS(op, ss, other.ss, child.ss, rng, cfg);
         }
      
 
-        // Uniform crossover for ms
+     // Uniform crossover for ms
         for (int i = 0; i < T; ++i) {
             if (uni_rnd(rng) < 0.5)
                 child.ms[i] = this->ms[i];
@@ -83,13 +98,11 @@ public:
                 child.ms[i] = other.ms[i];
         }
 
-        // Return Child
-        child.evaluate(cfg);
-        return child;
+        if (evaluate) child.evaluate(cfg);
     }
 
-    // Mutation
-    void mutate(const Config& cfg, double mutation_rate) {
+    // Mutation (回傳是否有變動；evaluate = true 時有變動就重新評估)
+    bool mutate(const Config& cfg, double mutation_rate, bool evaluate = true) {
         int T = cfg.theTCount;
         int P = cfg.thePCount;
         std::uniform_real_distribution<double> uni_rnd(0.0, 1.0);
@@ -109,14 +122,15 @@ public:
             ms[k] = mutation_point(rng);
             changed = true;
         }
-        if (changed) evaluate(cfg);
+        if (changed && evaluate) this->evaluate(cfg);
+        return changed;
     }
 
      
     void evaluate(const Config& cfg, bool show_adjust=false) {
         ScheduleResult res = Solution_Function(*this, cfg, show_adjust);
         this->cost    = res.makespan;
-        this->fitness = 1.0 / (this->cost + 1e-9);  
+        this->fitness = Fitness_Of(this->cost);
     }
 };
 // End To Define Individual 
@@ -205,95 +219,485 @@ namespace Selection_For_GA {
         }
     }
 
+
+
+
+    // 競賽選擇 (arena 版)：直接掃 cost 陣列，cost 最小者勝 (等同 fitness 最大)
+    int Tournament_Select(const std::vector<double>& costs, int tournament_size) {
+        std::uniform_int_distribution<int> dist(0, costs.size() - 1);
+        int best_idx = dist(rng);
+        for (int i = 1; i < tournament_size; ++i) {
+            int idx = dist(rng);
+            if (costs[idx] < costs[best_idx]) best_idx = idx;
+        }
+        return best_idx;
+    }
+
+
+    // Parent Selector：每個世代以族群 arena 的 cost 陣列重建一次，族群變動時遞增更新
+    //   r：Fenwick tree (權重 = fitness)，O(log N) 抽樣與更新
+    //   k：線性排名權重的 alias table，O(1) 抽樣；排名在世代開始時決定 (被替換的 slot 沿用原排名)
+    //   s：SUS，一次轉盤以等距指標抽出多個父代 (權重同 r，使用同一棵 Fenwick tree)
+    //   t：tournament (不需要額外結構)
+    // 權重與排名的暫存陣列是成員，放在 buffer 裡跨世代重複使用時 rebuild 不再配置
+    class Parent_Selector {
+    public:
+        Parent_Selector() = default;
+        Parent_Selector(const Population_Arena& pop, const GA_Params& params) {
+            reset(params);
+            rebuild(pop);
+        }
+
+        void reset(const GA_Params& params) {
+            method_   = params.selection_method;
+            pressure_ = params.rank_pressure;
+        }
+
+        void rebuild(const Population_Arena& pop) {
+            const std::vector<double>& cost = pop.costs();
+            int n = cost.size();
+            if (method_ == "r" || method_ == "s") {
+                w_.resize(n);
+                for (int i = 0; i < n; ++i) w_[i] = Fitness_Of(cost[i]);
+                fenwick_.build(w_);
+            } else if (method_ == "k") {
+                order_.resize(n);
+                std::iota(order_.begin(), order_.end(), 0);
+                std::sort(order_.begin(), order_.end(),
+                    [&cost](int a, int b){ return cost[a] < cost[b]; });
+                w_.resize(n);
+                for (int r = 0; r < n; ++r)
+                    w_[order_[r]] = (n == 1) ? 1.0
+                                  : (2.0 - pressure_) + 2.0 * (pressure_ - 1.0) * (n - 1 - r) / (n - 1);
+                alias_.build(w_);
+            }
+        }
+
+        // slot 的成員被替換後呼叫
+        void on_replace(int slot, double cost) {
+            if (method_ == "r" || method_ == "s") fenwick_.update(slot, Fitness_Of(cost));
+        }
+
+        int select(const Population_Arena& pop) {
+            if (method_ == "r" || method_ == "s") {
+                if (fenwick_.total() <= 0) return uniform(pop);
+                return fenwick_.sample(rng);
+            }
+            if (method_ == "k") return alias_.sample(rng);
+            return Tournament_Select(pop.costs(), 3);
+        }
+
+        // SUS：count 個等距指標，只轉一次盤
+        void select_sus(const Population_Arena& pop, int count, std::vector<int>& out) {
+            out.clear();
+            double total = fenwick_.total();
+            if (total <= 0 || count <= 0) {
+                for (int k = 0; k < count; ++k) out.push_back(uniform(pop));
+                return;
+            }
+            std::uniform_real_distribution<double> uni(0.0, 1.0);
+            double spacing = total / count;
+            double start = uni(rng) * spacing;
+            for (int k = 0; k < count; ++k) out.push_back(fenwick_.find(start + k * spacing));
+        }
+
+        // 選出兩個不同的父代
+        void select_pair(const Population_Arena& pop, int& P_idx1, int& P_idx2) {
+            if (method_ == "s") {
+                select_sus(pop, 2, pair_);
+                P_idx1 = pair_[0];
+                P_idx2 = pair_[1];
+            } else {
+                P_idx1 = select(pop);
+                P_idx2 = select(pop);
+            }
+            int tries = 0;
+            while (P_idx2 == P_idx1 && pop.size() > 1) {
+                P_idx2 = (++tries < 8) ? select(pop) : uniform(pop);
+            }
+        }
+
+        const std::string& method() const { return method_; }
+
+    private:
+        int uniform(const Population_Arena& pop) const {
+            std::uniform_int_distribution<int> dist(0, pop.size() - 1);
+            return dist(rng);
+        }
+
+        std::string method_;
+        double pressure_ = 1.5;
+        Fenwick_Sampler fenwick_;
+        Alias_Table alias_;
+        std::vector<double> w_;     // 重建用的權重
+        std::vector<int> order_;    // 排名式的排序
+        std::vector<int> pair_;
+    };
+
 }// End Selection  Define
 
 
 
 
 
+// 批次評估：把 arena 的前 count 個成員 (< 0 為全部) 切成 pool->size() 段並行評估，pool 為 nullptr 時逐一評估
+inline void Evaluate_Batch(Population_Arena& batch, const Config& config, Work_Stealing_Pool* pool = nullptr, int count = -1) {
+    int n = (count < 0) ? batch.size() : std::min(count, batch.size());
+    if (!pool || pool->size() <= 1 || n < 2) {
+        for (int i = 0; i < n; ++i) Evaluate_Member(batch.view(i), config);
+        return;
+    }
+    int chunks = std::min<int>(pool->size(), n);
+    for (int c = 0; c < chunks; ++c) {
+        int lo = (long long)n * c / chunks, hi = (long long)n * (c + 1) / chunks;
+        pool->submit([&batch, &config, lo, hi]{
+            for (int i = lo; i < hi; ++i) Evaluate_Member(batch.view(i), config);
+        });
+    }
+    pool->wait_idle();
+}
+
+
+// 交配與突變 (不評估)：pop 的父代 p1、p2 生出 child (另一個 arena 的一列，不可與父代相同)
+// 與 Individual::crossover_into + mutate 相同：ss 依 params.ss_crossover，ms 為 uniform crossover，
+// 突變為 ss 交換與 ms 隨機重設
+inline void Breed_Member(Population_Arena& pop, int p1, int p2, Member_View child,
+                         const Config& config, const GA_Params& params) {
+    int T = config.theTCount;
+    int P = config.thePCount;
+    std::uniform_real_distribution<double> uni_rnd(0.0, 1.0);
+    std::uniform_int_distribution<int> swap_selector(0, T-1);
+    std::uniform_int_distribution<int> mutation_point(0, P-1);
+
+    Row ssA = pop.ss(p1), ssB = pop.ss(p2);
+    if (uni_rnd(rng) < params.crossover_rate)
+        Crossover_Lib::Crossover_SS(params.ss_crossover, ssA, ssB, child.ss, rng, config);
+    else
+        child.ss.copy_from(ssA);
+
+    // Uniform crossover for ms
+    Row msA = pop.ms(p1), msB = pop.ms(p2);
+    for (int i = 0; i < T; ++i)
+        child.ms[i] = (uni_rnd(rng) < 0.5) ? msA[i] : msB[i];
+
+    //  ss 交換突變
+    if (uni_rnd(rng) < params.mutation_rate) {
+        int i = swap_selector(rng), j = swap_selector(rng);
+        std::swap(child.ss[i], child.ss[j]);
+    }
+    //  ms 隨機重設
+    if (uni_rnd(rng) < params.mutation_rate) {
+        int k = swap_selector(rng);
+        child.ms[k] = mutation_point(rng);
+    }
+}
+
+
+
+
+// 世代式的暫存：小孩的 arena 與替換用的 index，跨世代重複使用 (穩定後每代不再配置記憶體)
+struct Generational_Buffer {
+    Population_Arena offspring; // λ 個小孩 (λ x T)
+    vector<int> candidates;     // 參與截斷的 id：< μ 為父代 slot，>= μ 為小孩 (id - μ)
+    vector<char> kept;          // 父代 slot 是否保留
+    vector<int> mating;         // SUS 的父代序列
+    Fingerprint_Set seen;       // 本代小孩的指紋 (小孩之間的複製品)
+    Selection_For_GA::Parent_Selector selector;
+};
+
+
+// 世代式 (μ+λ)：先用目前族群產生全部 λ 個小孩 (不評估)，一次批次評估後再一次替換
+//   "p"：父代 + 小孩合併後取最好的 μ 個 (截斷)
+//   "e"：保留 elite_count 個最好的父代，其餘由最好的小孩補滿
+// 被選上的小孩複製進被淘汰父代的 slot (arena 中連續的一列)
+// diversity 不為 nullptr 且 reject_duplicates 時，與族群或本代其他小孩相同的小孩不評估 (修正後才相同的不參與替換)
+// 回傳花掉的評估次數
+long long Generational_Step(Population_Arena& population, Solution& best_so_far,
+                            Config& config, const GA_Params& params,
+                            Work_Stealing_Pool* pool = nullptr,
+                            Generational_Buffer* buffer = nullptr,
+                            Population_Diversity* diversity = nullptr) {
+    int mu     = population.size();
+    int lambda = params.offspring_size > 0 ? params.offspring_size : mu;
+    Generational_Buffer local;
+    Generational_Buffer& buf = buffer ? *buffer : local;
+    bool dedup = diversity && params.diversity.reject_duplicates;
+
+    Population_Arena& offspring = buf.offspring;
+    if (offspring.size() != lambda || offspring.tasks() != population.tasks())
+        offspring.reset(lambda, population.tasks());
+
+    // 1. 產生小孩 (選擇與變異都在呼叫端執行緒，結果與執行緒數無關)
+    //    SUS 一次抽出 2λ 個父代後打亂配對
+    Selection_For_GA::Parent_Selector& selector = buf.selector;
+    selector.reset(params);
+    selector.rebuild(population);
+    std::vector<int>& mating = buf.mating;
+    mating.clear();
+    if (selector.method() == "s") {
+        selector.select_sus(population, 2 * lambda, mating);
+        std::shuffle(mating.begin(), mating.end(), rng);
+    }
+    for (int i = 0; i < lambda; ++i) {
+        int P_idx1, P_idx2;
+        if (!mating.empty()) { P_idx1 = mating[2 * i]; P_idx2 = mating[2 * i + 1]; }
+        else selector.select_pair(population, P_idx1, P_idx2);
+        Breed_Member(population, P_idx1, P_idx2, offspring.view(i), config, params);
+    }
+
+    // 複製品移到尾端：回傳留下的個數
+    auto drop_duplicates = [&](int count) {
+        buf.seen.clear();
+        int kept = 0;
+        for (int i = 0; i < count; ++i) {
+            Row ss = offspring.ss(i), ms = offspring.ms(i);
+            uint64_t h = Fingerprint(ss, ms);
+            if (diversity->contains(ss, ms) || buf.seen.contains(h)) continue;
+            buf.seen.insert(h);
+            if (i != kept) offspring.swap_members(i, kept);
+            ++kept;
+        }
+        return kept;
+    };
+
+    // 2. 批次評估 (修正前就相同的不評估)
+    int evaluated = dedup ? drop_duplicates(lambda) : lambda;
+    Evaluate_Batch(offspring, config, pool, evaluated);
+    int valid = dedup ? drop_duplicates(evaluated) : evaluated;
+
+    // 3. 替換 (只排 index，cost 直接讀兩個 arena 的 cost 陣列)
+    auto cost_of = [&](int id){ return id < mu ? population.cost(id) : offspring.cost(id - mu); };
+    auto by_cost = [&](int a, int b){ return cost_of(a) < cost_of(b); };
+    vector<int>& cand = buf.candidates;
+    cand.clear();
+    for (int j = 0; j < mu; ++j) cand.push_back(j);
+    if (params.replacement == "e") {
+        // 精英父代一定保留 (不和小孩比)；小孩不夠補滿時再保留次好的父代
+        int keep = std::max(std::max(0, std::min(params.elite_count, mu)), mu - valid);
+        if (keep < mu) {
+            std::nth_element(cand.begin(), cand.begin() + keep, cand.end(), by_cost);
+            cand.resize(keep);
+        }
+        // 其餘 μ - keep 個 slot 只在小孩之間挑最好的
+        int need = mu - keep;
+        for (int k = 0; k < valid; ++k) cand.push_back(mu + k);
+        if (need < valid)
+            std::nth_element(cand.begin() + keep, cand.begin() + keep + need, cand.end(), by_cost);
+    } else {
+        for (int k = 0; k < valid; ++k) cand.push_back(mu + k);
+        std::nth_element(cand.begin(), cand.begin() + (mu - 1), cand.end(), by_cost);
+    }
+
+    buf.kept.assign(mu, 0);
+    for (int r = 0; r < mu; ++r) if (cand[r] < mu) buf.kept[cand[r]] = 1;
+    int slot = 0;
+    for (int r = 0; r < mu; ++r) {
+        if (cand[r] < mu) continue;
+        while (buf.kept[slot]) ++slot;
+        int c = cand[r] - mu;
+        if (diversity) {
+            diversity->remove(population.ss(slot), population.ms(slot));
+            diversity->add(offspring.ss(c), offspring.ms(c));
+        }
+        population.copy_member(slot, offspring, c);
+        buf.kept[slot] = 1;
+    }
+
+    // 4. 更新 best
+    int b = population.best_index();
+    if (population.cost(b) < best_so_far.cost) population.store(b, best_so_far);
+
+    return evaluated;
+}
+
+
+
+
+// 穩態世代的暫存：worst heap、父代選擇器與小孩的一列，跨世代重複使用 (穩定後每代不再配置記憶體)
+struct Steady_State_Buffer {
+    Indexed_Max_Heap worst_heap;
+    Selection_For_GA::Parent_Selector selector;
+    Population_Arena child;     // 1 x T
+};
+
+
+// 穩態世代：產生 population_size / 2 個小孩，每個小孩替換掉最差的個體 (精英除外)
+// 最差個體由 cost 的 indexed max-heap 取得 (O(log N))，精英以 slot 追蹤，不比較 cost 是否相等
+// 小孩在交配與突變後只評估一次；diversity 不為 nullptr 且 reject_duplicates 時，
+// 與族群中成員相同的小孩不評估 (修正後才相同的不插入)
+// 回傳花掉的評估次數；budget 不為 nullptr 時每個小孩都會檢查
+long long Steady_State_Generation(Population_Arena& population, Solution& best_so_far,
+                                  Config& config, const GA_Params& params,
+                                  Search_Budget* budget = nullptr,
+                                  Population_Diversity* diversity = nullptr,
+                                  Steady_State_Buffer* buffer = nullptr) {
+    long long evals = 0;
+    int offspring_count = params.population_size/2;  
+    bool dedup = diversity && params.diversity.reject_duplicates;
+    Steady_State_Buffer local;
+    Steady_State_Buffer& buf = buffer ? *buffer : local;
+    if (buf.child.size() != 1 || buf.child.tasks() != population.tasks())
+        buf.child.reset(1, population.tasks());
+
+    // 以 arena 的 cost 陣列建堆，精英 = cost 最小的 slot
+    Indexed_Max_Heap& worst_heap = buf.worst_heap;
+    worst_heap.build(population.costs());
+    int elite = population.best_index();
+    Selection_For_GA::Parent_Selector& selector = buf.selector;
+    selector.reset(params);
+    selector.rebuild(population);
+    Member_View child = buf.child.view(0);
+
+    for (int i = 0; i < offspring_count; ++i) {
+        // 1. 選擇兩個父代 (arena 中的 index，不複製)
+        int P_idx1, P_idx2;
+        selector.select_pair(population, P_idx1, P_idx2);
+
+        // 2. 生出一個小孩 (複製品不評估)
+        Breed_Member(population, P_idx1, P_idx2, child, config, params);
+        if (dedup && diversity->contains(child.ss, child.ms)) continue;
+        double child_cost = Evaluate_Member(child, config);
+        evals++;
+
+        // 3. 找最差的（非精英），替換
+        int idx_worst = worst_heap.top_except(elite);
+        if (idx_worst != -1 && child_cost < worst_heap.key(idx_worst)
+            && !(dedup && diversity->contains(child.ss, child.ms))) {
+            if (diversity) {
+                diversity->remove(population.ss(idx_worst), population.ms(idx_worst));
+                diversity->add(child.ss, child.ms);
+            }
+            population.copy_member(idx_worst, buf.child, 0);
+            worst_heap.update(idx_worst, child_cost);
+            selector.on_replace(idx_worst, child_cost);
+            if (child_cost < population.cost(elite)) elite = idx_worst;
+        }
+
+        // 4. 更新 best
+        if (child_cost < best_so_far.cost) {
+            buf.child.store(0, best_so_far);
+        }
+
+        if (budget && budget->spend(best_so_far.cost, 1)) break;
+    }
+    return evals;
+}
+
+
+
+
+// 多樣性觸發的移民：最差的 count 個成員 (best 除外) 換成隨機新解，回傳花掉的評估次數
+long long Diversity_Immigration(Population_Arena& population, Solution& best_so_far,
+                                Config& config, int count, Population_Diversity* diversity = nullptr) {
+    int N = population.size();
+    count = std::min(count, N - 1);
+    if (count <= 0) return 0;
+    std::vector<int> order(N);
+    std::iota(order.begin(), order.end(), 0);
+    std::partial_sort(order.begin(), order.begin() + count, order.end(),
+        [&population](int a, int b){ return population.cost(a) > population.cost(b); });
+    for (int k = 0; k < count; ++k) {
+        int w = order[k];
+        Solution sol = GenerateInitialSolution(config);
+        sol.cost = Solution_Function(sol, config).makespan;
+        if (diversity) diversity->remove(population.ss(w), population.ms(w));
+        population.load(w, sol);
+        if (diversity) diversity->add(population.ss(w), population.ms(w));
+        if (sol.cost < best_so_far.cost) best_so_far = sol;
+    }
+    return count;
+}
+
+
+// 初始族群：第一個成員可用 HEFT 解 (use_Heuristic)，其餘隨機，全部評估後放進 arena
+inline void Init_Population(Population_Arena& population, Config& config, const GA_Params& params) {
+    population.reset(params.population_size, config.theTCount);
+    for (int i = 0; i < params.population_size; ++i) {
+        Solution sol = GenerateInitialSolution(config, params.use_Heuristic && i == 0);
+        sol.cost = Solution_Function(sol, config).makespan;
+        population.load(i, sol);
+    }
+}
+
+
+
+
+
 // Genetic Algorith API , Need To Give The Config And Parameter of GA
+// 族群放在 Population_Arena (ss / ms / cost 各一塊連續記憶體)，best / 平均 / 選擇器重建都是連續掃描
+// params.generational = true 時改用世代式 (μ+λ)，每代的小孩以 thread pool 批次評估
+// params.diversity：複製品拒絕與多樣性觸發的移民；DV_Recorder 紀錄每代的族群多樣性 (0 ~ 1)
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
 Solution Genetic_Algorithm_2(Config& config, const GA_Params& params,
                                        vector<double>* GB_Recorder = nullptr,
-                                       vector<double>* LB_Recorder = nullptr) {
+                                       vector<double>* LB_Recorder = nullptr,
+                                       Search_Budget* budget = nullptr,
+                                       vector<double>* DV_Recorder = nullptr) {
+    if (budget) budget->start();
+    Crossover_Lib::Bind(config);   // 交配的 workspace 綁定這次的 DAG (每次執行一次)
+
     // 初始化
-    vector<Individual> population;
-    for (int i = 0; i < params.population_size; ++i)
-        population.emplace_back(config);
-    Individual best_so_far = population[0];
+    Population_Arena population;
+    Init_Population(population, config, params);
+    Solution best_so_far;
+    population.store(population.best_index(), best_so_far);
+    if (budget && budget->spend(best_so_far.cost, params.population_size)) {
+        budget->finish();
+        return best_so_far;
+    }
 
-    // 紀錄初始 GB/LB
-    if (GB_Recorder) GB_Recorder->push_back(best_so_far.cost);
-    if (LB_Recorder) {
-        double sum=0;
-        for (auto& ind: population) sum += ind.cost;
-        LB_Recorder->push_back(sum / population.size());
+    // 族群的指紋與多樣性 (有用到才維護)
+    const Diversity_Params& dp = params.diversity;
+    bool track = dp.reject_duplicates || dp.immigration_threshold > 0 || DV_Recorder;
+    Population_Diversity diversity;
+    if (track) {
+        diversity.reset(config.theTCount, config.thePCount);
+        for (int i = 0; i < population.size(); ++i) diversity.add(population.ss(i), population.ms(i));
     }
+    Population_Diversity* dv = track ? &diversity : nullptr;
+    Immigration_Policy immigration(dp);
 
-    // 穩態迭代
-    for (int gen = 0; gen < params.generations; ++gen) {
-    int offspring_count = params.population_size/2;  
-        for (int i = 0; i < offspring_count; ++i) {
-        // 1. 選擇兩個父代
-        
-            int P_idx1, P_idx2;
-            if (params.selection_method == "t") {
-                P_idx1 = Selection_For_GA::Tournament_Select(population, 3);  
-                P_idx2 = Selection_For_GA::Tournament_Select(population, 3);
-            } else if (params.selection_method == "r") {
-                P_idx1 = Selection_For_GA::Roulette_Select(population);
-                P_idx2 = Selection_For_GA::Roulette_Select(population);
-            } else {
-                // 預設用 tournament
-                P_idx1 = Selection_For_GA::Tournament_Select(population, 3);
-                P_idx2 = Selection_For_GA::Tournament_Select(population, 3);
-            }
+    // 紀錄初始 GB/LB
+    if (GB_Recorder) GB_Recorder->push_back(best_so_far.cost);
+    if (LB_Recorder) LB_Recorder->push_back(population.avg_cost());
+    if (DV_Recorder) DV_Recorder->push_back(diversity.diversity());
 
+    // 世代式才需要批次評估的 thread pool
+    std::unique_ptr<Work_Stealing_Pool> pool;
+    if (params.generational) pool.reset(new Work_Stealing_Pool(params.num_threads > 0 ? params.num_threads : 0));
+    Generational_Buffer buffer;
+    Steady_State_Buffer steady;
 
-            while (P_idx2 == P_idx1) {
-                    P_idx2 = (params.selection_method == "t") ?
-                    Selection_For_GA::Tournament_Select(population, 3) :
-                    Selection_For_GA::Roulette_Select(population);
-            }
-            Individual parent1 = population[P_idx1];
-            Individual parent2 = population[P_idx2];
-
-            // 2. 生出一個小孩
-            Individual child = parent1.crossover(parent2, config, params.crossover_rate);
-            child.mutate(config, params.mutation_rate);
-
-            // 3. 找最差的（非 best），替換
-            int idx_worst = -1;
-            double worst_cost = -1;
-            for (int j = 0; j < population.size(); ++j) {
-                if (population[j].cost > worst_cost && population[j].cost != best_so_far.cost) {
-                    worst_cost = population[j].cost;
-                    idx_worst = j;
-                }
-            }
-            if (idx_worst != -1 && child.cost < worst_cost) {
-                population[idx_worst] = child;
-            }
+    // 迭代 (穩態 / 世代式)
+    for (int gen = 0; gen < params.generations; ++gen) {
+        if (params.generational) {
+            long long evals = Generational_Step(population, best_so_far, config, params, pool.get(), &buffer, dv);
+            if (budget) budget->spend(best_so_far.cost, evals);
+        } else {
+            Steady_State_Generation(population, best_so_far, config, params, budget, dv, &steady);
+        }
 
-            // 4. 更新 best
-            if (child.cost < best_so_far.cost) {
-                best_so_far = child;
-            }
+        // 多樣性過低：最差的一部分換成隨機新解
+        if (dv && immigration.due(diversity.diversity(), gen)) {
+            long long evals = Diversity_Immigration(population, best_so_far, config,
+                                                    immigration.count(population.size()), dv);
+            if (budget) budget->spend(best_so_far.cost, evals);
         }
 
         // 5. 紀錄
         if (GB_Recorder) GB_Recorder->push_back(best_so_far.cost);
-        if (LB_Recorder) {
-            double sum = 0;
-            for (auto& ind : population) sum += ind.cost;
-            LB_Recorder->push_back(sum / population.size());
-        }
+        if (LB_Recorder) LB_Recorder->push_back(population.avg_cost());
+        if (DV_Recorder) DV_Recorder->push_back(diversity.diversity());
+
+        if (budget && budget->stopped()) break;
     }
 
-    return static_cast<Solution>(best_so_far);
+    if (budget) budget->finish();
+    return best_so_far;
 }
 
 
 
 
 
-#endif
\ No newline at end of file
+#endif
@@ -20,16 +20,20 @@ int main(){
     double count = 1;
     double Avg_Cost = 0;
 
-    vector<double> GB_Recorder , LB_Recorder;
+    vector<double> GB_Recorder , LB_Recorder , DV_Recorder;
 
     GA_Params params_ga;
     params_ga.population_size = 20;
     params_ga.generations = 200;
     params_ga.selection_method = "r";
+    params_ga.generational = false;   // true：世代式 (μ+λ)，每代小孩一次批次並行評估
+    params_ga.ss_crossover = Crossover_Lib::SS_Crossover::IPOX;   // 預設為 OX
+    params_ga.diversity.reject_duplicates     = true;   // 複製品不評估、不插入
+    params_ga.diversity.immigration_threshold = 0.1;    // 多樣性低於 0.1 時引入移民
 
     for (size_t i = 0; i < count; i++)
     {
-        Solution GA_Result = Genetic_Algorithm_2(config,params_ga, &GB_Recorder , &LB_Recorder);
+        Solution GA_Result = Genetic_Algorithm_2(config,params_ga, &GB_Recorder , &LB_Recorder, nullptr, &DV_Recorder);
         cout << "Best makespan: " << GA_Result.cost << "\n";
         show_solution(GA_Result);
         ScheduleResult sr = Solution_Function(GA_Result, config, true);
@@ -38,6 +42,7 @@ int main(){
         Avg_Cost+= GA_Result.cost;
     }
     cout<<"\n\n\nAvg_Cost : "<<Avg_Cost/count<<endl;
+    cout<<"Final Diversity : "<<DV_Recorder.back()<<endl;
 
     writeTwoVectorsToFile(GB_Recorder , LB_Recorder, "data.txt");
     Call_Py_Visual();
@@ -0,0 +1,51 @@
+#include "include/modules.hpp"
+#include "island_ga.hpp"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <random>
+
+using namespace std;
+using namespace os_display;
+using namespace std::chrono;
+
+
+ 
+
+int main(){
+    
+    Config config = ReadConfigFile("../../datasets/n4_00.dag");
+    vector<double> GB_Recorder , LB_Recorder;
+
+    // ----- Island GA Parameters ------
+    Island_Params params;
+    params.num_islands         = 8;                          // 每個 island 一條執行緒
+    params.ga.population_size  = 20;
+    params.ga.generations      = 200;
+    params.ga.selection_method = "r";
+    params.ga.ss_crossover     = Crossover_Lib::SS_Crossover::IPOX;
+    params.ga.diversity.reject_duplicates     = true;
+    params.ga.diversity.immigration_threshold = 0.1;
+    params.topology            = Migration_Topology::RING;   // RING / TORUS / FULL
+    params.migration_interval  = 10;                         // 每 10 個世代遷徙一次
+    params.migration_size      = 2;                          // 每次送出 2 個精英
+
+    auto start = high_resolution_clock::now();
+    Island_GA_Result result = Island_Genetic_Algorithm(config, params, &GB_Recorder, &LB_Recorder);
+    auto end = high_resolution_clock::now();
+
+    Solution& best = result.best;
+    cout << "Best makespan: " << best.cost << "\n";
+    show_solution(best);
+    ScheduleResult sr = Solution_Function(best, config, true);
+    cout << "Feasible: " << std::boolalpha << is_feasible(sr, config) << "\n";
+    cout << "Time Usage : " << duration_cast<milliseconds>(end - start).count() << " ms" << endl;
+
+    Show_Island_Statistics(result);
+
+    writeTwoVectorsToFile(GB_Recorder , LB_Recorder, "data.txt");
+    Call_Py_Visual();
+
+    return 0;
+}
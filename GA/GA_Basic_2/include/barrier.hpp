@@ -0,0 +1,32 @@
+#ifndef BARRIER_HPP
+#define BARRIER_HPP
+
+#include <mutex>
+#include <condition_variable>
+
+// 可重複使用的執行緒屏障：所有 num_threads 條執行緒都呼叫 wait() 後才一起放行
+class Thread_Barrier {
+public:
+    explicit Thread_Barrier(int num_threads) : count_(num_threads), waiting_(0), generation_(0) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(m_);
+        unsigned long gen = generation_;
+        if (++waiting_ == count_) {
+            waiting_ = 0;
+            ++generation_;
+            cv_.notify_all();
+            return;
+        }
+        cv_.wait(lock, [this, gen]{ return gen != generation_; });
+    }
+
+private:
+    std::mutex m_;
+    std::condition_variable cv_;
+    int count_;
+    int waiting_;
+    unsigned long generation_;
+};
+
+#endif
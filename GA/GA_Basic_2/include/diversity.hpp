@@ -0,0 +1,221 @@
+#ifndef DIVERSITY_HPP
+#define DIVERSITY_HPP
+
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+
+// Population Diversity
+//   Fingerprint       ：(ss, ms) 的 64-bit 指紋，插入族群前判斷是否為複製品
+//   Diversity_Tracker ：族群多樣性，成員加入 / 移除時遞增更新 (O(T + K))
+//       ms：位置 Hamming 距離 (每個 task 各機器的成員數)
+//       ss：Kendall tau 距離，以 K 個固定抽樣的 task pair 估計 (每個 pair 記錄 a 排在 b 前的成員數)
+//   Immigration_Policy：多樣性低於門檻時，以隨機新解替換最差的一部分成員
+// 容器只需要 size() / operator[] (vector<int> 與 arena 的 Row 都可以)
+
+
+// ----- Diversity Parameters ------
+struct Diversity_Params {
+    bool reject_duplicates;         // 與族群中成員完全相同的小孩不評估、不插入
+    double immigration_threshold;   // 多樣性 (0 ~ 1) 低於此值時引入移民，<= 0 關閉
+    double immigration_ratio;       // 每次替換族群的比例
+    int immigration_cooldown;       // 兩次移民之間至少間隔幾個世代
+
+    // 預設全部關閉 (與加入前的行為相同)，由呼叫端明確開啟
+    Diversity_Params(){
+        reject_duplicates     = false;
+        immigration_threshold = 0.0;
+        immigration_ratio     = 0.2;
+        immigration_cooldown  = 10;
+    }
+};
+
+
+
+
+// (ss, ms) 的指紋：逐位置混合 (ss[i], ms[i])，與位置相關
+template <typename SS, typename MS>
+inline uint64_t Fingerprint(const SS& ss, const MS& ms) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (uint64_t)ss.size();
+    for (int i = 0; i < (int)ss.size(); ++i) {
+        uint64_t x = h + ((uint64_t)(uint32_t)ss[i] << 32 | (uint32_t)ms[i]) + 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        h = x ^ (x >> 31);
+    }
+    return h;
+}
+
+
+// 族群中各指紋的個數 (初始族群可能本來就有重複，所以用計數)
+class Fingerprint_Set {
+public:
+    void clear() { count_.clear(); }
+    bool contains(uint64_t h) const { return count_.find(h) != count_.end(); }
+    void insert(uint64_t h) { count_[h]++; }
+    void erase(uint64_t h) {
+        auto it = count_.find(h);
+        if (it != count_.end() && --it->second == 0) count_.erase(it);
+    }
+    int distinct() const { return count_.size(); }
+
+private:
+    std::unordered_map<uint64_t, int> count_;
+};
+
+
+
+
+// 遞增更新的族群多樣性
+class Diversity_Tracker {
+public:
+    // T 個 task、P 台機器；Kendall 估計用的 pair 由固定種子抽出 (不影響全域 rng)
+    void reset(int T, int P, int max_pairs = 0) {
+        T_ = T;
+        P_ = std::max(1, P);
+        N_ = 0;
+        ms_count_.assign((size_t)T_ * P_, 0);
+        ms_sq_ = 0;
+
+        long long all = (long long)T_ * (T_ - 1) / 2;
+        int K = max_pairs > 0 ? max_pairs : 4 * T_;
+        pairs_.clear();
+        if (all <= K) {
+            for (int a = 0; a < T_; ++a)
+                for (int b = a + 1; b < T_; ++b) pairs_.push_back({a, b});
+        } else {
+            std::mt19937 gen(0x5EED);
+            std::uniform_int_distribution<int> dist(0, T_ - 1);
+            while ((int)pairs_.size() < K) {
+                int a = dist(gen), b = dist(gen);
+                if (a != b) pairs_.push_back({a, b});
+            }
+        }
+        before_.assign(pairs_.size(), 0);
+        before_sum_ = before_sq_ = 0;
+        pos_.assign(T_, 0);
+    }
+
+    template <typename SS, typename MS>
+    void add(const SS& ss, const MS& ms) { apply(ss, ms, +1); }
+
+    template <typename SS, typename MS>
+    void remove(const SS& ss, const MS& ms) { apply(ss, ms, -1); }
+
+    int members() const { return N_; }
+
+    // 平均兩兩 ms Hamming 距離 / T
+    double ms_diversity() const {
+        if (N_ < 2 || T_ == 0) return 0.0;
+        double sq = (double)N_ * N_ * T_ - (double)ms_sq_;
+        return sq / ((double)N_ * (N_ - 1) * T_);
+    }
+
+    // 平均兩兩 Kendall tau 距離 (正規化到 0 ~ 1) 的估計：
+    // 每個 pair 有 c 個成員把 a 排在 b 前，不一致的成員對數為 c (N - c)
+    double ss_diversity() const {
+        if (N_ < 2 || pairs_.empty()) return 0.0;
+        double discordant = (double)N_ * before_sum_ - (double)before_sq_;
+        return 2.0 * discordant / ((double)N_ * (N_ - 1) * pairs_.size());
+    }
+
+    double diversity() const { return 0.5 * (ms_diversity() + ss_diversity()); }
+
+private:
+    template <typename SS, typename MS>
+    void apply(const SS& ss, const MS& ms, int sign) {
+        for (int t = 0; t < T_; ++t) {
+            int& c = ms_count_[(size_t)t * P_ + ms[t]];
+            ms_sq_ += sign > 0 ? 2LL * c + 1 : -2LL * c + 1;
+            c += sign;
+        }
+        for (int i = 0; i < T_; ++i) pos_[ss[i]] = i;
+        for (size_t k = 0; k < pairs_.size(); ++k) {
+            if (pos_[pairs_[k].first] > pos_[pairs_[k].second]) continue;
+            int& c = before_[k];
+            before_sq_ += sign > 0 ? 2LL * c + 1 : -2LL * c + 1;
+            before_sum_ += sign;
+            c += sign;
+        }
+        N_ += sign;
+    }
+
+    int T_ = 0, P_ = 1, N_ = 0;
+    std::vector<int> ms_count_;                 // T x P：task t 分到機器 m 的成員數
+    long long ms_sq_ = 0;                       // Σ count²
+    std::vector<std::pair<int,int>> pairs_;     // 抽樣的 task pair
+    std::vector<int> before_;                   // 每個 pair 中 a 排在 b 前的成員數
+    long long before_sum_ = 0, before_sq_ = 0;  // Σ before、Σ before²
+    std::vector<int> pos_;                      // 暫存：task -> 位置
+};
+
+
+
+
+// 族群的指紋集合 + 多樣性，成員變動時一起更新
+class Population_Diversity {
+public:
+    void reset(int T, int P) {
+        fingerprints_.clear();
+        tracker_.reset(T, P);
+    }
+
+    template <typename SS, typename MS>
+    bool contains(const SS& ss, const MS& ms) const { return fingerprints_.contains(Fingerprint(ss, ms)); }
+
+    template <typename SS, typename MS>
+    void add(const SS& ss, const MS& ms) {
+        fingerprints_.insert(Fingerprint(ss, ms));
+        tracker_.add(ss, ms);
+    }
+
+    template <typename SS, typename MS>
+    void remove(const SS& ss, const MS& ms) {
+        fingerprints_.erase(Fingerprint(ss, ms));
+        tracker_.remove(ss, ms);
+    }
+
+    int distinct() const { return fingerprints_.distinct(); }
+    double diversity() const { return tracker_.diversity(); }
+    const Diversity_Tracker& tracker() const { return tracker_; }
+
+private:
+    Fingerprint_Set fingerprints_;
+    Diversity_Tracker tracker_;
+};
+
+
+
+
+// 多樣性觸發的移民：多樣性低於門檻且距離上次移民已過 cooldown 個世代時觸發
+class Immigration_Policy {
+public:
+    explicit Immigration_Policy(const Diversity_Params& params = Diversity_Params()) : params_(params) {}
+
+    bool due(double diversity, int generation) {
+        if (params_.immigration_threshold <= 0 || diversity >= params_.immigration_threshold) return false;
+        if (triggered_ && generation - last_ < params_.immigration_cooldown) return false;
+        triggered_ = true;
+        last_ = generation;
+        times_++;
+        return true;
+    }
+
+    // 族群大小 N 時每次替換幾個成員 (至少 1，最多 N - 1，保留最好的)
+    int count(int N) const {
+        int k = (int)(params_.immigration_ratio * N + 0.5);
+        return std::max(1, std::min(k, N - 1));
+    }
+
+    int times() const { return times_; }
+
+private:
+    Diversity_Params params_;
+    bool triggered_ = false;
+    int last_ = 0;
+    int times_ = 0;
+};
+
+#endif
@@ -0,0 +1,419 @@
+#ifndef HEFT_HPP
+#define HEFT_HPP
+
+#include "config.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// HEFT (Heterogeneous Earliest Finish Time, Topcuoglu et al. 2002)
+// 1. upward rank：rank_u(t) = avg_w(t) + max_{s ∈ succ(t)} ( avg_c(t, s) + rank_u(s) )
+//    avg_w：t 在各處理器上的平均計算時間；avg_c：資料量 × 處理器之間 (p ≠ q) 的平均傳輸率
+// 2. 依 rank_u 遞減 (同分取拓撲序較前者) 逐一排程，每個任務挑 EFT 最小的處理器，
+//    可以插進處理器時間軸上已排任務之間的空檔 (insertion-based)
+// DAG 的 CSR、rank 與優先順序依 Config 的內容快取 (thread_local)，內容相同的 Config 重複呼叫只重做排程
+
+
+// ----- Config Fingerprint ------
+// theCompCost / theCommRate / theTransDataVol 的內容雜湊 (逐個 double 的位元以 splitmix64 混合，與位置相關)
+// O(T·P + P² + E)，與一次 HEFT 排程同量級；同一個位址上重新讀入或原地修改的 Config 也認得出來
+inline uint64_t Config_Fingerprint(const Config& c) {
+    auto mix = [](uint64_t h, uint64_t x) {
+        x += h + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    };
+    auto add_rows = [&mix](uint64_t h, const std::vector<std::vector<double>>& rows) {
+        h = mix(h, rows.size());
+        for (const auto& row : rows) {
+            h = mix(h, row.size());
+            for (double v : row) {
+                uint64_t bits;
+                std::memcpy(&bits, &v, sizeof bits);
+                h = mix(h, bits);
+            }
+        }
+        return h;
+    };
+    uint64_t h = mix(mix(0, c.theTCount), c.thePCount);
+    h = add_rows(h, c.theCompCost);
+    h = add_rows(h, c.theCommRate);
+    return add_rows(h, c.theTransDataVol);
+}
+
+
+// ----- DAG Cache ------
+// 以 (T, P, E, Config_Fingerprint) 辨識：只看內容不看位址，內容變了就重建
+struct HEFT_Cache {
+    bool built = false;
+    uint64_t key = 0;
+    unsigned int T = 0, P = 0;
+    size_t E = 0;
+
+    // CSR：pred_task[pred_off[t] .. pred_off[t+1]) 為 t 的前驅，succ 同理
+    std::vector<int> pred_off, pred_task;
+    std::vector<double> pred_vol;
+    std::vector<int> succ_off, succ_task;
+    std::vector<double> succ_vol;
+
+    std::vector<int> topo;          // 拓撲序 (Kahn)
+    std::vector<int> topo_pos;      // topo_pos[t]：t 在 topo 的位置
+    std::vector<double> avg_w;      // 平均計算時間
+    double avg_rate = 0.0;          // p ≠ q 的平均傳輸率
+    std::vector<double> rank_u;
+    std::vector<int> order;         // 排程優先順序 (rank_u 遞減)
+
+    bool matches(const Config& c, uint64_t k) const {
+        return built && key == k && T == c.theTCount && P == c.thePCount && E == c.theTransDataVol.size();
+    }
+
+    void bind(const Config& c) {
+        uint64_t k = Config_Fingerprint(c);
+        if (matches(c, k)) return;
+        built = true;
+        key = k;
+        T = c.theTCount;
+        P = c.thePCount;
+        E = c.theTransDataVol.size();
+        build_csr(c);
+        build_topo();
+        build_ranks(c);
+    }
+
+private:
+    void build_csr(const Config& c) {
+        pred_off.assign(T + 1, 0);
+        succ_off.assign(T + 1, 0);
+        for (const auto& e : c.theTransDataVol) {
+            succ_off[(int)e[0] + 1]++;
+            pred_off[(int)e[1] + 1]++;
+        }
+        for (unsigned int t = 0; t < T; ++t) {
+            succ_off[t + 1] += succ_off[t];
+            pred_off[t + 1] += pred_off[t];
+        }
+        pred_task.resize(E); pred_vol.resize(E);
+        succ_task.resize(E); succ_vol.resize(E);
+        std::vector<int> ps(pred_off.begin(), pred_off.end() - 1);
+        std::vector<int> ss(succ_off.begin(), succ_off.end() - 1);
+        for (const auto& e : c.theTransDataVol) {
+            int from = (int)e[0], to = (int)e[1];
+            double vol = e[2];
+            succ_task[ss[from]] = to;   succ_vol[ss[from]++] = vol;
+            pred_task[ps[to]]   = from; pred_vol[ps[to]++]   = vol;
+        }
+    }
+
+    void build_topo() {
+        topo.clear();
+        topo.reserve(T);
+        std::vector<int> indeg(T);
+        for (unsigned int t = 0; t < T; ++t) {
+            indeg[t] = pred_off[t + 1] - pred_off[t];
+            if (indeg[t] == 0) topo.push_back(t);
+        }
+        for (size_t head = 0; head < topo.size(); ++head) {
+            int t = topo[head];
+            for (int k = succ_off[t]; k < succ_off[t + 1]; ++k)
+                if (--indeg[succ_task[k]] == 0) topo.push_back(succ_task[k]);
+        }
+        // 有環時 (不合法的輸入) 剩下的任務接在最後，避免漏排
+        if (topo.size() < T) {
+            for (unsigned int t = 0; t < T; ++t)
+                if (indeg[t] > 0) topo.push_back(t);
+        }
+        topo_pos.resize(T);
+        for (unsigned int i = 0; i < T; ++i) topo_pos[topo[i]] = i;
+    }
+
+    void build_ranks(const Config& c) {
+        avg_w.resize(T);
+        for (unsigned int t = 0; t < T; ++t) {
+            const auto& row = c.theCompCost[t];
+            avg_w[t] = P ? std::accumulate(row.begin(), row.begin() + P, 0.0) / P : 0.0;
+        }
+
+        avg_rate = 0.0;
+        if (P > 1) {
+            for (unsigned int p = 0; p < P; ++p)
+                for (unsigned int q = 0; q < P; ++q)
+                    if (p != q) avg_rate += c.theCommRate[p][q];
+            avg_rate /= double(P) * (P - 1);
+        }
+
+        // 反拓撲序：後繼的 rank 都已算好
+        rank_u.assign(T, 0.0);
+        for (int i = (int)T - 1; i >= 0; --i) {
+            int t = topo[i];
+            double tail = 0.0;
+            for (int k = succ_off[t]; k < succ_off[t + 1]; ++k)
+                tail = std::max(tail, succ_vol[k] * avg_rate + rank_u[succ_task[k]]);
+            rank_u[t] = avg_w[t] + tail;
+        }
+
+        // rank 遞減；前驅的 rank 不小於後繼，同分時取拓撲序較前者，所以 order 也是拓撲序
+        order.resize(T);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [this](int a, int b) {
+            if (rank_u[a] != rank_u[b]) return rank_u[a] > rank_u[b];
+            return topo_pos[a] < topo_pos[b];
+        });
+    }
+};
+
+inline HEFT_Cache& HEFT_Cache_For(const Config& cfg) {
+    thread_local HEFT_Cache cache;
+    cache.bind(cfg);
+    return cache;
+}
+
+
+
+
+// ----- Processor Timeline ------
+// 一個處理器上已佔用的時段，依時間排序且互不重疊；同一塊內首尾相接的時段合併，只剩真正的空檔需要檢查
+// (長度 0 的任務因此不會排在合併時段的接縫上，而是排到合併時段的結尾，排程仍然合法)。
+// 時段分塊存放 (每塊最多 2 * CHUNK 個)，每塊的「最大空檔」(塊內相鄰時段之間，以及與前一塊之間) 放在
+// max 線段樹上：找空檔時只逐一檢查 ready 所在的那一塊，之後直接在樹上找第一個放得下的塊，O(CHUNK + log n)
+class Processor_Timeline {
+public:
+    void clear() { chunks_.clear(); chunk_end_.clear(); tree_.clear(); leaves_ = 0; }
+
+    // 最後一個時段的結束時間 (空的為 0)
+    double end_time() const { return chunk_end_.empty() ? 0.0 : chunk_end_.back(); }
+
+    // ready 之後第一個放得下 dur 的開始時間；
+    // 開始時間 + dur 已經 > finish_limit 時提早回傳 (回傳值 + dur > finish_limit，只是下界；呼叫端不會採用)
+    double earliest_start(double ready, double dur,
+                          double finish_limit = std::numeric_limits<double>::infinity()) const {
+        // 放在最後 (最常見)，或從 ready 開始都贏不了
+        if (chunk_end_.empty() || ready >= chunk_end_.back() || ready + dur > finish_limit) return ready;
+
+        // ready 所在的塊：先看 ready 所在的空檔，其餘塊內空檔只有最大空檔 >= dur 時才逐一檢查
+        int c = last_chunk_after(ready);
+        const std::vector<Block>& first = chunks_[c].b;
+        auto it = std::upper_bound(first.begin(), first.end(), ready,
+                                   [](double r, const Block& blk) { return r < blk.end; });
+        double s = ready;
+        if (s + dur <= it->start) return s;
+        if (chunks_[c].max_gap >= dur) {
+            for (; it != first.end(); ++it) {
+                if (s + dur <= it->start) return s;
+                s = std::max(s, it->end);
+                if (s + dur > finish_limit) return s;
+            }
+        }
+        s = std::max(s, chunk_end_[c]);
+        if (s + dur > finish_limit) return s;
+
+        // 之後的塊：樹上找第一個最大空檔 >= dur 的塊，中間的塊都放不下
+        while ((c = find_first(c + 1, dur)) >= 0) {
+            const std::vector<Block>& b = chunks_[c].b;
+            s = std::max(s, chunk_end_[c - 1]);
+            if (s + dur > finish_limit) return s;
+            if (s + dur <= b.front().start) return s;
+            for (size_t i = 1; i < b.size(); ++i) {
+                if (b[i - 1].end + dur <= b[i].start) return b[i - 1].end;
+                if (b[i].end + dur > finish_limit) return b[i].end;
+            }
+            s = chunk_end_[c];
+        }
+        return std::max(s, chunk_end_.back());
+    }
+
+    // 佔用 [s, f)，必須是 earliest_start 找到的空檔；
+    // 長度 0 的任務也記成一個時間點，之後插入的任務不會跨過它 (否則依開始時間排出的 ss 會把它往後推)
+    void occupy(double s, double f) {
+        if (chunks_.empty()) {
+            chunks_.emplace_back();
+            chunks_.back().b.push_back(Block{s, f});
+            chunk_end_.push_back(f);
+            rebuild();
+            return;
+        }
+
+        // 第一個結束時間 > s 的塊 (s 在兩塊之間的空檔時放進後一塊的開頭；都沒有則最後一塊)
+        int c = std::upper_bound(chunk_end_.begin(), chunk_end_.end(), s) - chunk_end_.begin();
+        if (c == (int)chunks_.size()) --c;
+        std::vector<Block>& b = chunks_[c].b;
+
+        // 插在第一個結束時間 > s 的時段之前，與首尾相接的時段合併
+        auto it = std::upper_bound(b.begin(), b.end(), s,
+                                   [](double v, const Block& blk) { return v < blk.end; });
+        bool joinPrev = it != b.begin() && std::prev(it)->end == s;
+        bool joinNext = it != b.end() && it->start == f;
+        if (joinPrev && joinNext) {
+            std::prev(it)->end = it->end;
+            b.erase(it);
+        } else if (joinPrev) {
+            std::prev(it)->end = f;
+        } else if (joinNext) {
+            it->start = s;
+        } else {
+            b.insert(it, Block{s, f});
+        }
+
+        if (b.size() > 2 * CHUNK) {
+            Chunk right;
+            right.b.assign(b.begin() + CHUNK, b.end());
+            b.resize(CHUNK);
+            chunks_[c].refresh();
+            right.refresh();
+            chunk_end_[c] = b.back().end;
+            chunk_end_.insert(chunk_end_.begin() + c + 1, right.b.back().end);
+            chunks_.insert(chunks_.begin() + c + 1, std::move(right));
+            // 最後一塊分裂 (任務大多接在最後) 且樹還放得下時只更新兩個葉子，否則整棵重建
+            if (c + 2 == (int)chunks_.size() && (int)chunks_.size() <= leaves_) {
+                update(c);
+                update(c + 1);
+            } else {
+                rebuild();
+            }
+        } else {
+            chunks_[c].refresh();
+            chunk_end_[c] = b.back().end;
+            update(c);
+            if (c + 1 < (int)chunks_.size()) update(c + 1);
+        }
+    }
+
+private:
+    static const size_t CHUNK = 32;
+
+    struct Block { double start, end; };
+    struct Chunk {
+        std::vector<Block> b;
+        double max_gap = 0.0;       // 塊內相鄰時段之間最大的空檔
+        void refresh() {
+            max_gap = 0.0;
+            for (size_t i = 1; i < b.size(); ++i) max_gap = std::max(max_gap, b[i].start - b[i - 1].end);
+        }
+    };
+    std::vector<Chunk> chunks_;
+    std::vector<double> chunk_end_;     // 各塊最後一個時段的結束時間 (二分搜尋用，不必碰到塊的內容)
+
+    // max 線段樹 (葉子 = 塊，值 = 塊內最大空檔與塊前空檔取大；多出來的葉子為 -1)
+    std::vector<double> tree_;
+    int leaves_ = 0;
+
+    // 第一個結束時間 > v 的塊 (呼叫端保證最後一塊的結束時間 > v)；
+    // v 通常接近時間軸尾端，從最後一塊倍增往前找，再在找到的區間內二分
+    int last_chunk_after(double v) const {
+        int hi = (int)chunk_end_.size() - 1, lo = -1;
+        for (int step = 1; hi - step >= 0; step <<= 1) {
+            if (chunk_end_[hi - step] <= v) { lo = hi - step; break; }
+            hi -= step;
+        }
+        return std::upper_bound(chunk_end_.begin() + lo + 1, chunk_end_.begin() + hi, v) - chunk_end_.begin();
+    }
+
+    double leaf_value(int c) const {
+        double v = chunks_[c].max_gap;
+        if (c > 0) v = std::max(v, chunks_[c].b.front().start - chunk_end_[c - 1]);
+        return v;
+    }
+
+    void rebuild() {
+        leaves_ = 1;
+        while (leaves_ < 2 * (int)chunks_.size()) leaves_ <<= 1;     // 留一倍空間給之後的分裂
+        tree_.assign(2 * leaves_, -1.0);
+        for (int c = 0; c < (int)chunks_.size(); ++c) tree_[leaves_ + c] = leaf_value(c);
+        for (int i = leaves_ - 1; i >= 1; --i) tree_[i] = std::max(tree_[2 * i], tree_[2 * i + 1]);
+    }
+
+    void update(int c) {
+        int i = leaves_ + c;
+        tree_[i] = leaf_value(c);
+        for (i >>= 1; i >= 1; i >>= 1) tree_[i] = std::max(tree_[2 * i], tree_[2 * i + 1]);
+    }
+
+    // 第一個 index >= lo 且值 >= x 的塊，沒有則 -1
+    int find_first(int lo, double x) const {
+        if (lo >= (int)chunks_.size()) return -1;
+        int i = leaves_ + lo;
+        while (tree_[i] < x) {
+            while (i & 1) i >>= 1;      // 往上直到是左子節點
+            if (i == 0) return -1;
+            ++i;                        // 換到右邊的兄弟
+        }
+        while (i < leaves_) {
+            i = 2 * i;
+            if (tree_[i] < x) ++i;
+        }
+        return i - leaves_ < (int)chunks_.size() ? i - leaves_ : -1;
+    }
+};
+
+
+
+
+// ----- HEFT ------
+// 回傳的 ss 依 HEFT 的 (開始時間, 結束時間) 排序 (相同時取優先順序較前者)，是合法的拓撲序；
+// 每台處理器上的任務依時間軸順序出現，所以非插入式的 Calculate_schedule 算出的 makespan 不會超過 HEFT 的排程。
+// cost 設為 HEFT 排程的 makespan
+inline Solution HEFT_Solution(const Config& cfg) {
+    HEFT_Cache& G = HEFT_Cache_For(cfg);
+    int T = G.T, P = G.P;
+
+    Solution sol;
+    sol.ms.assign(T, 0);
+    sol.ss.resize(T);
+    sol.cost = 0.0;
+    if (T == 0 || P == 0) return sol;
+
+    std::vector<double> start(T, 0.0), finish(T, 0.0);
+    std::vector<Processor_Timeline> timeline(P);
+    std::vector<double> ready(P);
+
+    for (int t : G.order) {
+        const std::vector<double>& w = cfg.theCompCost[t];
+
+        // 各處理器的 ready time (考慮前驅的通訊延遲)；接在時間軸最後一定可行，
+        // 其中最早的完成時間當作找空檔的上限，超過的處理器不必碰它的時間軸
+        double bound = std::numeric_limits<double>::infinity();
+        for (int p = 0; p < P; ++p) {
+            double r = 0.0;
+            for (int k = G.pred_off[t]; k < G.pred_off[t + 1]; ++k) {
+                int u = G.pred_task[k];
+                int pu = sol.ms[u];
+                double comm = (pu != p) ? G.pred_vol[k] * cfg.theCommRate[pu][p] : 0.0;
+                r = std::max(r, finish[u] + comm);
+            }
+            ready[p] = r;
+            bound = std::min(bound, std::max(r, timeline[p].end_time()) + w[p]);
+        }
+
+        double bestFinish = std::numeric_limits<double>::infinity();
+        double bestStart = 0.0;
+        int bestProc = 0;
+        for (int p = 0; p < P; ++p) {
+            double s = timeline[p].earliest_start(ready[p], w[p], std::min(bound, bestFinish));
+            if (s + w[p] < bestFinish) {
+                bestFinish = s + w[p];
+                bestStart = s;
+                bestProc = p;
+            }
+        }
+        sol.ms[t] = bestProc;
+        start[t] = bestStart;
+        finish[t] = bestFinish;
+        timeline[bestProc].occupy(bestStart, bestFinish);
+        sol.cost = std::max(sol.cost, bestFinish);
+    }
+
+    // ss：依 (開始, 結束) 時間排序，相同時依優先順序 (stable)；同一時間點上長度 0 的任務排在前面
+    sol.ss = G.order;
+    std::stable_sort(sol.ss.begin(), sol.ss.end(), [&start, &finish](int a, int b) {
+        if (start[a] != start[b]) return start[a] < start[b];
+        return finish[a] < finish[b];
+    });
+    return sol;
+}
+
+#endif
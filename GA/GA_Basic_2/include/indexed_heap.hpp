@@ -0,0 +1,82 @@
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <vector>
+#include <utility>
+
+// Indexed Max-Heap：對 slot 0..n-1 的 key 建最大堆，
+// 可以 O(1) 查最大、O(log n) 更新任一 slot 的 key (族群的 replace-worst 用)
+class Indexed_Max_Heap {
+public:
+    Indexed_Max_Heap() = default;
+
+    // 以 keys 建堆 O(n)
+    void build(const std::vector<double>& keys) {
+        key_ = keys;
+        int n = key_.size();
+        heap_.resize(n);
+        pos_.resize(n);
+        for (int i = 0; i < n; ++i) heap_[i] = pos_[i] = i;
+        for (int i = n / 2 - 1; i >= 0; --i) sift_down(i);
+    }
+
+    int size() const { return heap_.size(); }
+    bool empty() const { return heap_.empty(); }
+
+    // key 最大的 slot
+    int top() const { return heap_[0]; }
+
+    // 除了 excluded 之外 key 最大的 slot (只有 excluded 一個時回傳 -1)
+    int top_except(int excluded) const {
+        if (heap_.empty()) return -1;
+        if (heap_[0] != excluded) return heap_[0];
+        int best = -1;
+        for (int c = 1; c <= 2 && c < (int)heap_.size(); ++c)
+            if (best == -1 || key_[heap_[c]] > key_[best]) best = heap_[c];
+        return best;
+    }
+
+    double key(int slot) const { return key_[slot]; }
+
+    // 更新 slot 的 key 並重新調整位置
+    void update(int slot, double new_key) {
+        double old = key_[slot];
+        key_[slot] = new_key;
+        if (new_key > old) sift_up(pos_[slot]);
+        else               sift_down(pos_[slot]);
+    }
+
+private:
+    void swap_nodes(int a, int b) {
+        std::swap(heap_[a], heap_[b]);
+        pos_[heap_[a]] = a;
+        pos_[heap_[b]] = b;
+    }
+
+    void sift_up(int i) {
+        while (i > 0) {
+            int p = (i - 1) / 2;
+            if (key_[heap_[p]] >= key_[heap_[i]]) break;
+            swap_nodes(i, p);
+            i = p;
+        }
+    }
+
+    void sift_down(int i) {
+        int n = heap_.size();
+        while (true) {
+            int l = 2 * i + 1, r = l + 1, m = i;
+            if (l < n && key_[heap_[l]] > key_[heap_[m]]) m = l;
+            if (r < n && key_[heap_[r]] > key_[heap_[m]]) m = r;
+            if (m == i) break;
+            swap_nodes(i, m);
+            i = m;
+        }
+    }
+
+    std::vector<int> heap_;     // 堆中位置 -> slot
+    std::vector<int> pos_;      // slot -> 堆中位置
+    std::vector<double> key_;   // slot 的 key
+};
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef POPULATION_ARENA_HPP
+#define POPULATION_ARENA_HPP
+
+#include "config.hpp"
+#include "evaluation.hpp"
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+// 一列基因 (ss 或 ms) 的輕量 view：指向 arena 中的連續記憶體，
+// 提供 begin / end / operator[] / size，std 演算法與以 Vec 寫的算子都可以直接套用
+struct Row {
+    int* ptr;
+    int len;
+
+    int* begin() const { return ptr; }
+    int* end()   const { return ptr + len; }
+    int& operator[](int i) const { return ptr[i]; }
+    int size() const { return len; }
+    void resize(int n) const { (void)n; }   // 長度固定，為了與 vector 介面相容
+
+    // 複製到 / 從 vector
+    void assign_to(std::vector<int>& v) const { v.assign(ptr, ptr + len); }
+    void copy_from(const std::vector<int>& v) const { std::copy(v.begin(), v.begin() + len, ptr); }
+    void copy_from(const Row& r) const { std::copy(r.begin(), r.end(), ptr); }
+};
+
+
+// 族群成員的 view
+struct Member_View {
+    Row ss;
+    Row ms;
+    double* cost;
+};
+
+
+// Population Arena (Structure of Arrays)
+// 所有成員的 ss 放在一塊連續記憶體、ms 放在另一塊、cost 為一個密集陣列；
+// 成員以 index 存取 (Member_View)，整個族群的平均 / 最佳 / 距離計算都是連續掃描。
+// reset() 之後大小不變，迭代中不再配置記憶體
+class Population_Arena {
+public:
+    Population_Arena() = default;
+    Population_Arena(int count, int T) { reset(count, T); }
+
+    void reset(int count, int T) {
+        count_ = count;
+        T_ = T;
+        ss_.assign((size_t)count * T, 0);
+        ms_.assign((size_t)count * T, 0);
+        cost_.assign(count, std::numeric_limits<double>::infinity());
+    }
+
+    int size() const { return count_; }
+    int tasks() const { return T_; }
+
+    Row ss(int i) { return Row{ ss_.data() + (size_t)i * T_, T_ }; }
+    Row ms(int i) { return Row{ ms_.data() + (size_t)i * T_, T_ }; }
+    const int* ss(int i) const { return ss_.data() + (size_t)i * T_; }
+    const int* ms(int i) const { return ms_.data() + (size_t)i * T_; }
+    double& cost(int i) { return cost_[i]; }
+    double cost(int i) const { return cost_[i]; }
+    const std::vector<double>& costs() const { return cost_; }
+
+    Member_View view(int i) { return Member_View{ ss(i), ms(i), &cost_[i] }; }
+
+    // Solution <-> arena
+    void load(int i, const Solution& sol) {
+        std::copy(sol.ss.begin(), sol.ss.end(), ss_.begin() + (size_t)i * T_);
+        std::copy(sol.ms.begin(), sol.ms.end(), ms_.begin() + (size_t)i * T_);
+        cost_[i] = sol.cost;
+    }
+    void store(int i, Solution& sol) const {
+        sol.ss.assign(ss(i), ss(i) + T_);
+        sol.ms.assign(ms(i), ms(i) + T_);
+        sol.cost = cost_[i];
+    }
+
+    // 成員 src (可來自另一個 arena) 複製到 dst
+    void copy_member(int dst, const Population_Arena& from, int src) {
+        std::copy(from.ss(src), from.ss(src) + T_, ss_.begin() + (size_t)dst * T_);
+        std::copy(from.ms(src), from.ms(src) + T_, ms_.begin() + (size_t)dst * T_);
+        cost_[dst] = from.cost_[src];
+    }
+
+    // 兩個成員互換 (同一個 arena)
+    void swap_members(int a, int b) {
+        std::swap_ranges(ss_.begin() + (size_t)a * T_, ss_.begin() + (size_t)(a + 1) * T_, ss_.begin() + (size_t)b * T_);
+        std::swap_ranges(ms_.begin() + (size_t)a * T_, ms_.begin() + (size_t)(a + 1) * T_, ms_.begin() + (size_t)b * T_);
+        std::swap(cost_[a], cost_[b]);
+    }
+
+    // 整個族群互換 (雙緩衝)
+    void swap(Population_Arena& other) {
+        std::swap(count_, other.count_);
+        std::swap(T_, other.T_);
+        ss_.swap(other.ss_);
+        ms_.swap(other.ms_);
+        cost_.swap(other.cost_);
+    }
+
+    // ---- 整個族群的統計 (連續掃描 cost 陣列) ----
+    int best_index() const {
+        return std::min_element(cost_.begin(), cost_.end()) - cost_.begin();
+    }
+    int worst_index() const {
+        return std::max_element(cost_.begin(), cost_.end()) - cost_.begin();
+    }
+    double avg_cost() const {
+        double sum = 0.0;
+        for (double c : cost_) sum += c;
+        return count_ ? sum / count_ : 0.0;
+    }
+
+private:
+    int count_ = 0;
+    int T_ = 0;
+    std::vector<int> ss_;       // count x T
+    std::vector<int> ms_;       // count x T
+    std::vector<double> cost_;  // count
+};
+
+
+// 評估 arena 中的一個成員：複製到每條執行緒自己的暫存 Solution 做 Solution_Function，
+// 修正後的 ss 與 cost 寫回 arena (暫存 Solution 重複使用，不另外配置)
+inline double Evaluate_Member(Member_View m, const Config& config) {
+    thread_local Solution scratch;
+    m.ss.assign_to(scratch.ss);
+    m.ms.assign_to(scratch.ms);
+    ScheduleResult res = Solution_Function(scratch, config);
+    m.ss.copy_from(scratch.ss);
+    *m.cost = res.makespan;
+    return res.makespan;
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef SAMPLING_HPP
+#define SAMPLING_HPP
+
+#include <vector>
+#include <random>
+
+// Fenwick Tree (Binary Indexed Tree) 依權重抽樣：
+// O(log n) 更新單一權重、O(log n) 依累積權重找 index
+class Fenwick_Sampler {
+public:
+    Fenwick_Sampler() = default;
+
+    // 以 weights 建樹 O(n)
+    void build(const std::vector<double>& weights) {
+        n_ = weights.size();
+        w_ = weights;
+        tree_.assign(n_ + 1, 0.0);
+        for (int i = 1; i <= n_; ++i) {
+            tree_[i] += w_[i - 1];
+            int parent = i + (i & -i);
+            if (parent <= n_) tree_[parent] += tree_[i];
+        }
+        step_ = 1;
+        while (step_ * 2 <= n_) step_ *= 2;
+    }
+
+    int size() const { return n_; }
+    double weight(int i) const { return w_[i]; }
+
+    double total() const {
+        double s = 0.0;
+        for (int i = n_; i > 0; i -= i & -i) s += tree_[i];
+        return s;
+    }
+
+    // 修改 index i 的權重
+    void update(int i, double new_weight) {
+        double delta = new_weight - w_[i];
+        w_[i] = new_weight;
+        for (int k = i + 1; k <= n_; k += k & -k) tree_[k] += delta;
+    }
+
+    // 第一個累積權重 > u 的 index (u in [0, total))
+    int find(double u) const {
+        int pos = 0;
+        for (int step = step_; step > 0; step >>= 1) {
+            if (pos + step <= n_ && tree_[pos + step] <= u) {
+                pos += step;
+                u -= tree_[pos];
+            }
+        }
+        return pos < n_ ? pos : n_ - 1;
+    }
+
+    template <typename Engine>
+    int sample(Engine& gen) const {
+        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        return find(uni(gen) * total());
+    }
+
+private:
+    int n_ = 0;
+    int step_ = 1;
+    std::vector<double> w_;
+    std::vector<double> tree_;   // 1-based
+};
+
+
+
+
+// Alias Table (Vose)：O(n) 建表後 O(1) 抽樣，權重不變時使用
+class Alias_Table {
+public:
+    Alias_Table() = default;
+
+    void build(const std::vector<double>& weights) {
+        int n = weights.size();
+        prob_.assign(n, 0.0);
+        alias_.assign(n, 0);
+        double sum = 0.0;
+        for (double w : weights) sum += w;
+        if (n == 0) return;
+        if (sum <= 0) {
+            for (int i = 0; i < n; ++i) { prob_[i] = 1.0; alias_[i] = i; }
+            return;
+        }
+
+        // 暫存陣列是成員，重建時不再配置
+        std::vector<double>& scaled = scaled_;
+        std::vector<int>& small = small_;
+        std::vector<int>& large = large_;
+        scaled.resize(n);
+        small.clear();
+        large.clear();
+        for (int i = 0; i < n; ++i) {
+            scaled[i] = weights[i] * n / sum;
+            (scaled[i] < 1.0 ? small : large).push_back(i);
+        }
+        while (!small.empty() && !large.empty()) {
+            int s = small.back(); small.pop_back();
+            int l = large.back();
+            prob_[s]  = scaled[s];
+            alias_[s] = l;
+            scaled[l] -= 1.0 - scaled[s];
+            if (scaled[l] < 1.0) { large.pop_back(); small.push_back(l); }
+        }
+        for (int i : large) { prob_[i] = 1.0; alias_[i] = i; }
+        for (int i : small) { prob_[i] = 1.0; alias_[i] = i; }   // 浮點誤差
+    }
+
+    int size() const { return prob_.size(); }
+
+    template <typename Engine>
+    int sample(Engine& gen) const {
+        std::uniform_int_distribution<int> col(0, (int)prob_.size() - 1);
+        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        int i = col(gen);
+        return uni(gen) < prob_[i] ? i : alias_[i];
+    }
+
+private:
+    std::vector<double> prob_;
+    std::vector<int> alias_;
+    std::vector<double> scaled_;
+    std::vector<int> small_, large_;
+};
+
+#endif
@@ -0,0 +1,273 @@
+#ifndef ISLAND_GA_HPP
+#define ISLAND_GA_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/barrier.hpp"
+#include "GA.hpp"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+
+
+
+
+// 遷徙拓撲
+enum class Migration_Topology {
+    RING,    // i 從 i-1 接收
+    TORUS,   // rows x cols 網格，從上下左右四個鄰居接收
+    FULL     // 從所有其他 island 接收
+};
+
+
+// ----- Island GA Parameters ------
+struct Island_Params {
+    int num_islands;               // island 數量，每個 island 一條執行緒
+    GA_Params ga;                  // 每個 island 的 GA 參數 (generations = 總世代數)
+    Migration_Topology topology;
+    int migration_interval;        // 每幾個世代遷徙一次
+    int migration_size;            // 每次送出的精英數量
+    unsigned int seed;             // 隨機種子 (各 island 由此衍生)
+
+    Island_Params(){
+        num_islands        = 8;
+        topology           = Migration_Topology::RING;
+        migration_interval = 10;
+        migration_size     = 2;
+        seed               = std::random_device{}();
+    }
+};
+
+
+struct Island_Stats {
+    double best_cost    = 0.0;
+    double avg_cost     = 0.0;
+    long long evals     = 0;
+    long long immigrants = 0;      // 被接受 (替換掉本地個體) 的移民數
+    double diversity    = 0.0;     // 結束時的族群多樣性 (0 ~ 1)
+};
+
+
+struct Island_GA_Result {
+    Solution best;
+    std::vector<Island_Stats> islands;
+    int epochs = 0;                // 遷徙次數
+};
+
+
+inline void Show_Island_Statistics(const Island_GA_Result& result) {
+    printf("\n%-8s %-10s %-10s %-10s %-10s %-10s\n", "island", "best", "avg", "evals", "immigrant", "diversity");
+    for (size_t k = 0; k < result.islands.size(); ++k) {
+        const Island_Stats& s = result.islands[k];
+        printf("%-8zu %-10.2f %-10.2f %-10lld %-10lld %-10.3f\n", k, s.best_cost, s.avg_cost, s.evals, s.immigrants, s.diversity);
+    }
+    printf("epochs = %d\n", result.epochs);
+}
+
+
+
+
+// 每個 island 接收移民的來源
+inline std::vector<std::vector<int>> Migration_Sources(int M, Migration_Topology topology) {
+    std::vector<std::vector<int>> sources(M);
+    if (M <= 1) return sources;
+
+    if (topology == Migration_Topology::RING) {
+        for (int i = 0; i < M; ++i) sources[i].push_back((i - 1 + M) % M);
+    } else if (topology == Migration_Topology::FULL) {
+        for (int i = 0; i < M; ++i)
+            for (int j = 0; j < M; ++j) if (j != i) sources[i].push_back(j);
+    } else {
+        // 最接近正方形的 rows x cols (M 為質數時退化成 1 x M 的環)
+        int cols = 1;
+        for (int c = 1; c * c <= M; ++c) if (M % c == 0) cols = c;
+        int rows = M / cols;
+        for (int i = 0; i < M; ++i) {
+            int r = i / cols, c = i % cols;
+            int nbr[4] = { ((r - 1 + rows) % rows) * cols + c, ((r + 1) % rows) * cols + c,
+                           r * cols + (c - 1 + cols) % cols,   r * cols + (c + 1) % cols };
+            for (int j : nbr)
+                if (j != i && std::find(sources[i].begin(), sources[i].end(), j) == sources[i].end())
+                    sources[i].push_back(j);
+        }
+    }
+    return sources;
+}
+
+
+
+
+// 單一 island：族群、best 與送出的精英都只由自己的執行緒建立與修改 (first-touch 配置在該執行緒所在的 NUMA node)，
+// 族群與 outbox 都是 Population_Arena (連續記憶體)；alignas(64) 避免相鄰 island 的計數器共用 cache line
+struct alignas(64) Island {
+    Population_Arena population;
+    Solution best;
+    Generational_Buffer buffer;     // 世代式的暫存 (跨世代重複使用)
+    Steady_State_Buffer steady;     // 穩態的暫存 (跨世代重複使用)
+    Population_Diversity diversity; // 本地族群的指紋與多樣性
+    Immigration_Policy immigration; // 多樣性觸發的隨機移民
+    Population_Arena outbox[2];     // 依 epoch 奇偶交替使用，讀取與下一次送出不會衝突
+    vector<int> order;              // 挑精英用的 index 暫存
+    vector<std::pair<Population_Arena*, int>> incoming;   // 收到的移民 (來源 outbox, index)
+    long long epoch_evals = 0;      // 本次 epoch 的評估數 (由 thread 0 收走)
+    Island_Stats stats;
+
+    void init(Config& config, const GA_Params& params) {
+        Init_Population(population, config, params);
+        population.store(population.best_index(), best);
+        epoch_evals = params.population_size;
+        diversity.reset(config.theTCount, config.thePCount);
+        for (int i = 0; i < population.size(); ++i) diversity.add(population.ss(i), population.ms(i));
+        immigration = Immigration_Policy(params.diversity);
+    }
+
+    // 跑一個世代 (含多樣性觸發的移民)，回傳花掉的評估次數
+    long long generation(Config& config, const GA_Params& params, int gen) {
+        long long evals = params.generational
+                        ? Generational_Step(population, best, config, params, nullptr, &buffer, &diversity)
+                        : Steady_State_Generation(population, best, config, params, nullptr, &diversity, &steady);
+        if (immigration.due(diversity.diversity(), gen))
+            evals += Diversity_Immigration(population, best, config, immigration.count(population.size()), &diversity);
+        return evals;
+    }
+
+    // 送出 migration_size 個最好的個體 (複製到 outbox，族群本身不重排)
+    void emigrate(int epoch, int migration_size) {
+        Population_Arena& out = outbox[epoch % 2];
+        int k = std::min<int>(migration_size, population.size());
+        order.resize(population.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(order.begin(), order.begin() + k, order.end(),
+            [this](int a, int b){ return population.cost(a) < population.cost(b); });
+        if (out.size() != k || out.tasks() != population.tasks()) out.reset(k, population.tasks());
+        for (int j = 0; j < k; ++j) out.copy_member(j, population, order[j]);
+    }
+
+    // 收下來源 island 的移民，比本地最差的好才替換 (reject_duplicates 時與本地成員相同的移民略過)
+    // 來源的 outbox 在兩個 barrier 之間不會被改寫，只讀
+    void immigrate(int epoch, std::vector<Island>& islands, const std::vector<int>& sources, int migration_size,
+                   bool reject_duplicates) {
+        incoming.clear();
+        for (int j : sources) {
+            Population_Arena& out = islands[j].outbox[epoch % 2];
+            for (int i = 0; i < out.size(); ++i) incoming.push_back({&out, i});
+        }
+        std::sort(incoming.begin(), incoming.end(),
+            [](const std::pair<Population_Arena*, int>& a, const std::pair<Population_Arena*, int>& b){
+                return a.first->cost(a.second) < b.first->cost(b.second); });
+        if ((int)incoming.size() > migration_size) incoming.resize(migration_size);
+
+        for (const auto& in : incoming) {
+            Population_Arena& src = *in.first;
+            int i = in.second;
+            int worst = population.worst_index();
+            if (src.cost(i) >= population.cost(worst)) break;
+            if (reject_duplicates && diversity.contains(src.ss(i), src.ms(i))) continue;
+            diversity.remove(population.ss(worst), population.ms(worst));
+            diversity.add(src.ss(i), src.ms(i));
+            population.copy_member(worst, src, i);
+            stats.immigrants++;
+            if (src.cost(i) < best.cost) src.store(i, best);
+        }
+    }
+};
+
+
+
+
+// Island-Model GA
+// 每個 island 在自己的執行緒上跑 Steady_State_Generation，每 migration_interval 個世代
+// 依拓撲把精英送到鄰居 island，移民替換掉本地最差的個體
+// budget 在每次遷徙時檢查 (粒度 = migration_interval 個世代)
+Island_GA_Result Island_Genetic_Algorithm(Config& config, const Island_Params& params,
+                                          vector<double>* GB_Recorder = nullptr,
+                                          vector<double>* LB_Recorder = nullptr,
+                                          Search_Budget* budget = nullptr) {
+    int M = std::max(1, params.num_islands);
+    int interval = std::max(1, params.migration_interval);
+    int epochs = (params.ga.generations + interval - 1) / interval;
+    if (budget) budget->start();
+    Crossover_Lib::Bind(config);   // 各 island 執行緒的交配 workspace 在第一次交配時綁定這次的 DAG
+
+    std::seed_seq seq{params.seed};
+    std::vector<unsigned int> seeds(M);
+    seq.generate(seeds.begin(), seeds.end());
+
+    std::vector<Island> islands(M);
+    std::vector<std::vector<int>> sources = Migration_Sources(M, params.topology);
+
+    Solution global_best;
+    global_best.cost = std::numeric_limits<double>::infinity();
+    std::atomic<bool> stop(false);
+    int epochs_done = 0;
+    Thread_Barrier barrier(M);
+
+    // 紀錄、budget 與 global best：只在 thread 0 於兩個 barrier 之間執行
+    auto collect = [&]() {
+        long long evals = 0;
+        double sum = 0.0;
+        for (auto& isl : islands) {
+            evals += isl.epoch_evals;
+            isl.stats.evals += isl.epoch_evals;
+            isl.epoch_evals = 0;
+            if (isl.best.cost < global_best.cost) global_best = isl.best;
+            sum += isl.population.avg_cost() * isl.population.size();
+        }
+        if (GB_Recorder) GB_Recorder->push_back(global_best.cost);
+        if (LB_Recorder) LB_Recorder->push_back(sum / (M * std::max(1, islands[0].population.size())));
+        if (budget && budget->spend(global_best.cost, evals)) stop = true;
+    };
+
+    auto worker = [&](int k) {
+        rng.seed(seeds[k]);
+        Island& isl = islands[k];
+        isl.init(config, params.ga);
+        barrier.wait();
+        if (k == 0) collect();
+        barrier.wait();
+
+        for (int e = 0; e < epochs && !stop; ++e) {
+            int gens = std::min(interval, params.ga.generations - e * interval);
+            for (int g = 0; g < gens; ++g)
+                isl.epoch_evals += isl.generation(config, params.ga, e * interval + g);
+            isl.emigrate(e, params.migration_size);
+
+            barrier.wait();
+            if (k == 0) { collect(); epochs_done = e + 1; }
+            barrier.wait();
+
+            isl.immigrate(e, islands, sources[k], params.migration_size, params.ga.diversity.reject_duplicates);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(M - 1);
+    for (int k = 1; k < M; ++k) threads.emplace_back(worker, k);
+    worker(0);
+    for (auto& th : threads) th.join();
+
+    Island_GA_Result result;
+    result.epochs = epochs_done;
+    result.islands.resize(M);
+    for (int k = 0; k < M; ++k) {
+        Island& isl = islands[k];
+        if (isl.best.cost < global_best.cost) global_best = isl.best;
+        result.islands[k] = isl.stats;
+        result.islands[k].best_cost = isl.best.cost;
+        result.islands[k].avg_cost  = isl.population.avg_cost();
+        result.islands[k].diversity = isl.diversity.diversity();
+    }
+    result.best = global_best;
+    if (budget) budget->finish();
+    return result;
+}
+
+
+
+#endif
@@ -0,0 +1,46 @@
+#include "include/modules.hpp"
+#include "parallel_tempering.hpp"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <random>
+
+using namespace std;
+using namespace os_display;
+using namespace std::chrono;
+
+
+ 
+
+int main()
+{   
+    vector<double> Global_Best_Recorder , Current_Best_Recorder;
+    Config config = ReadConfigFile("../../datasets/n4_00.dag");
+
+    // ----- PT Parameters ------
+    PT_Params params;
+    params.num_chains = 8;      // 每條 chain 一個執行緒
+    params.T_low      = 1.0;    // 最冷溫度
+    params.T_high     = 100.0;  // 最熱溫度 (原 SA 的初始溫度)
+    params.sweep_len  = 50;     // 每次交換前的 Metropolis 步數
+    params.num_rounds = 100;
+
+    auto start = high_resolution_clock::now();
+    PT_Result result = Parallel_Tempering_SA(config, params, &Global_Best_Recorder, &Current_Best_Recorder);
+    auto end = high_resolution_clock::now();
+
+    Solution& sol = result.best;
+    cout<<"Best Solution : \n";
+    show_solution(sol);
+    ScheduleResult SR =  Solution_Function(sol,config,true);
+    cout<<"Feasible : "<<boolalpha<<is_feasible(SR,config)<<endl;
+    cout<<"Best Cost : "<<SR.makespan<<endl;
+    cout<<"Time Usage : "<<duration_cast<milliseconds>(end - start).count()<<" ms"<<endl;
+
+    Show_PT_Statistics(result);
+
+    writeTwoVectorsToFile(Global_Best_Recorder, Current_Best_Recorder, "data.txt");
+    Call_Py_Visual();
+    return 0;
+}
@@ -0,0 +1,395 @@
+#ifndef SA_HPP
+#define SA_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/operator_selector.hpp"
+#include <vector>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <algorithm>
+
+
+
+// 冷卻排程
+enum class Cooling_Schedule {
+    GEOMETRIC,           // T *= alpha (原本的排程)
+    TARGET_ACCEPTANCE,   // 調整 T 使接受率追蹤由 initial_accept 指數下降到 final_accept 的目標
+    LAM                  // Lam-Delosme：目標接受率 0.44 為主體的三段式曲線
+};
+
+
+struct SA_Params {
+    double T;                   // 初始溫度
+    double T_min;              // 最低溫度
+    double alpha;             // 冷卻係數 (0.9–0.99)
+    int iterPerTemp;         // 每個溫度迴圈次數
+    int max_Iter;           // 最大總迭代次數
+    int max_NoImprove;     // 連續無改善上限
+    bool use_Heuristic;   // 是否啟用啟發式初解
+    bool verbose;        // 是否印出初解 cost
+    Selector_Strategy operator_strategy;   // 鄰域算子選擇方式 (UNIFORM = 原本的 rng() % 3)
+
+    // ---- 自適應冷卻 ----
+    Cooling_Schedule cooling;
+    bool calibrate_T;          // 由初解鄰居的 delta 取樣決定 T / T_min (取代手調的 T)
+    int calibration_samples;   // 取樣鄰居數
+    double initial_accept;     // 初始時對上坡移動的平均接受機率 χ0
+    double final_accept;       // 結束時對最小上坡移動的接受機率
+    double adapt_factor;       // TARGET_ACCEPTANCE / LAM 每步的溫度調整倍率，<= 0 依 max_Iter 自動決定
+    int reheat_after;          // 連續多少步沒有更新 best 就回溫 (0 = 不回溫)
+    double reheat_ratio;       // 回溫到初始溫度的比例，並從 best 重新出發
+
+    SA_Params(){
+        T              = 100.0;             // 例如：根據問題規模可自己調整
+        T_min          = 1e-3;             // 例如：當溫度低於此值時停止 
+        alpha          = 0.85;            // 每次迴圈後溫度乘上 alpha
+        iterPerTemp    = 5;              // 每個溫度底下做多少次鄰域搜尋
+        max_Iter       = 400;           // 最多總迭代次數
+        max_NoImprove  = 6000;         // 連續多少次沒有改善就停止
+        use_Heuristic  = true;       // 預設用隨機初始解
+        verbose        = false;
+        operator_strategy = Selector_Strategy::ADAPTIVE_PURSUIT;
+
+        cooling             = Cooling_Schedule::GEOMETRIC;
+        calibrate_T         = false;
+        calibration_samples = 50;
+        initial_accept      = 0.8;
+        final_accept        = 0.01;
+        adapt_factor        = 0.0;
+        reheat_after        = 0;
+        reheat_ratio        = 0.5;
+    }
+};
+
+
+// 預設參數 (回傳複本，每次呼叫都是新的一組)
+SA_Params set_SA_param() {
+    return SA_Params();
+}
+
+
+// 依問題規模縮放的參數：迭代數與 task 數成正比，溫度由取樣校正，
+// 不需要針對每個 dataset 手調 (n = 20 時迭代數與預設值相同)
+SA_Params Scaled_SA_Params(const Config& config, Cooling_Schedule cooling = Cooling_Schedule::TARGET_ACCEPTANCE) {
+    SA_Params params;
+    int n = std::max(1, (int)config.theTCount);
+    params.max_Iter            = 20 * n;
+    params.iterPerTemp         = std::max(5, n / 4);
+    params.max_NoImprove       = 15 * params.max_Iter;
+    params.calibration_samples = std::max(50, 2 * n);
+    params.reheat_after        = 5 * n;
+    params.calibrate_T         = true;
+    params.initial_accept      = 0.2;   // 迭代數不多，χ0 太高會把前段都花在隨機漫步
+    params.cooling             = cooling;
+    return params;
+}
+
+
+// Lam-Delosme 目標接受率 (progress = 0 ~ 1)
+inline double Lam_Target_Acceptance(double progress) {
+    if (progress < 0.15) return 0.44 + 0.56 * std::pow(560.0, -progress / 0.15);
+    if (progress < 0.65) return 0.44;
+    return 0.44 * std::pow(440.0, -(progress - 0.65) / 0.35);
+}
+
+ 
+
+// MetaHerustic Interface
+/*
+| 0    | Swap in `ss`               | 交換兩個任務的順序
+| 1    | Change in `ms`             | 隨機改變某個任務的處理器分配 
+| 2    | Swap in `ss` + modify `ms` | 同時調整順序與處理器配置（加強探索） 
+*/
+const int SA_NUM_MOVES = 3;
+const std::vector<std::string> SA_MOVE_NAMES = {"swap ss", "change ms", "swap + change"};
+
+template <typename Engine>
+Solution GenerateNeighbor(const Solution& current, const Config& config, Engine& gen, int move_type) {
+    Solution neighbor = current;
+    int T = config.theTCount;
+    int P = config.thePCount;
+
+    if (move_type == 0 || move_type == 2) {
+        int i = gen() % T;
+        int j = gen() % T;
+        while (j == i) j = gen() % T;
+        std::swap(neighbor.ss[i], neighbor.ss[j]);
+    }
+
+    if (move_type == 1 || move_type == 2) {
+         
+        int t = gen() % T;
+        int newP = gen() % P;
+        while (newP == neighbor.ms[t] && P > 1) {
+            newP = gen() % P;
+        }
+        neighbor.ms[t] = newP;
+    }
+
+    return neighbor;
+}
+
+// Randomly Choose A Method Operator to Get Neighbor
+template <typename Engine>
+Solution GenerateNeighbor(const Solution& current, const Config& config, Engine& gen) {
+    int move_type = gen() % SA_NUM_MOVES;  // 0: swap ss, 1: change ms, 2: both
+    return GenerateNeighbor(current, config, gen, move_type);
+}
+
+// 預設使用全域 rng
+inline Solution GenerateNeighbor(const Solution& current, const Config& config) {
+    return GenerateNeighbor(current, config, rng);
+}
+
+ 
+
+
+
+// SA Engine
+// 參數、溫度、計數器與隨機引擎都屬於各自的 engine，
+// 可以在同一個 process 內重複執行，或在多條執行緒上各跑一個 engine
+class SA_Engine {
+public:
+    SA_Engine(const Config& config, const SA_Params& params = SA_Params(),
+              unsigned int seed = std::random_device{}())
+        : cfg_(&config), params_(params), gen_(seed),
+          selector_(SA_NUM_MOVES, params.operator_strategy),
+          T_(params.T), T0_(params.T), T_min_(params.T_min), alpha_(params.alpha),
+          iter_(0), noImproveCount_(0), reheats_(0) {}
+
+    // 執行一次完整的 SA；每次 run() 都從 params 的初始溫度重新開始
+    // budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+    Solution run(vector<double>* GB_Recorder = nullptr , vector<double>* CB_Recorder = nullptr , Search_Budget* budget = nullptr) {
+        const Config& config = *cfg_;
+        T_ = T0_ = params_.T;
+        T_min_ = params_.T_min;
+        alpha_ = params_.alpha;
+        iter_ = 0;
+        noImproveCount_ = 0;
+        reheats_ = 0;
+        selector_.set_strategy(params_.operator_strategy);
+        selector_.reset(SA_NUM_MOVES);
+        if (budget) budget->start();
+
+        // initialize 
+        Solution current_S = GenerateInitialSolution(config, params_.use_Heuristic, gen_);
+        ScheduleResult result = Solution_Function(current_S,config);
+        double currentCost = result.makespan;
+        if (params_.verbose) cout<<"init : "<< currentCost <<endl;
+
+        // Best Init
+        Solution Best_Solution = current_S;
+        double best_Cost = currentCost;
+        if (budget && budget->spend(best_Cost)) {
+            budget->finish();
+            return Best_Solution;
+        }
+        if (params_.calibrate_T && !calibrate(current_S, currentCost, Best_Solution, best_Cost, budget)) {
+            if (budget) budget->finish();
+            return Best_Solution;
+        }
+        if (params_.verbose && params_.calibrate_T) cout<<"T0 : "<< T0_ <<"  T_min : "<< T_min_ <<endl;
+
+        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        bool adaptive = (params_.cooling != Cooling_Schedule::GEOMETRIC);
+        double factor = adaptive_factor();
+        double accept_rate = params_.initial_accept;   // 接受率的移動平均
+        double rate_weight = 1.0 / std::min(500, std::max(10, params_.max_Iter / 20));
+        double target = params_.initial_accept;
+        int sinceBest = 0;
+
+        // SA Main Loop (自適應排程不以 T_min 停止，溫度下限為 T_min)
+        while((adaptive || T_ > T_min_) &&  iter_ < params_.max_Iter){
+            if (adaptive) target = target_acceptance(progress(budget));
+            for (int i = 0; i < params_.iterPerTemp; ++i) {
+                int move = selector_.select(gen_);
+                Solution  Neighbor_Solution = GenerateNeighbor(current_S, config, gen_, move);
+                ScheduleResult nei_result = Solution_Function(Neighbor_Solution, config);
+                double newCost = nei_result.makespan;
+                selector_.reward(move, (currentCost - newCost) / currentCost);
+
+
+                double delta = newCost - currentCost;
+                // Make decision for Accept Neighbor Solution or Not
+                bool accept = false;
+                if (delta <= 0) {
+                    accept = true;
+                } else {
+                    double prob = std::exp(-delta / T_);
+                    if (uni(gen_) < prob) {
+                        accept = true;
+                    }
+                }
+
+                if (accept) {
+                    current_S = Neighbor_Solution;
+                    currentCost = newCost;
+                    if (newCost < best_Cost) {
+                        Best_Solution = Neighbor_Solution;
+                        best_Cost = newCost;
+                        noImproveCount_ = 0; 
+                        sinceBest = -1;
+                    } else {
+                        noImproveCount_++;
+                    }
+                }
+                sinceBest++;
+
+                // 接受率高於目標就降溫，低於目標就升溫
+                if (adaptive) {
+                    accept_rate += rate_weight * ((accept ? 1.0 : 0.0) - accept_rate);
+                    T_ = (accept_rate > target) ? T_ * factor : T_ / factor;
+                    T_ = std::min(std::max(T_, T_min_), T0_);
+                }
+
+                // 停滯太久：回溫並從 best 重新出發
+                if (params_.reheat_after > 0 && sinceBest >= params_.reheat_after) {
+                    T_ = std::max(T_, T0_ * params_.reheat_ratio);
+                    current_S = Best_Solution;
+                    currentCost = best_Cost;
+                    accept_rate = std::max(accept_rate, target);
+                    sinceBest = 0;
+                    reheats_++;
+                }
+
+                iter_++;
+                if (budget && budget->spend(best_Cost)) break;
+                if (iter_ >= params_.max_Iter || noImproveCount_ >= params_.max_NoImprove) break;
+            }
+
+            if (GB_Recorder) GB_Recorder->push_back(Best_Solution.cost);
+            if (CB_Recorder) CB_Recorder->push_back(current_S.cost);
+
+            if (!adaptive) T_ *= alpha_;
+            if (budget && budget->stopped()) break;
+            if (noImproveCount_ >= params_.max_NoImprove) break;
+        }
+
+        if (budget) budget->finish(noImproveCount_ >= params_.max_NoImprove ? Stop_Reason::NO_IMPROVE : Stop_Reason::MAX_ITERATION);
+        return Best_Solution;
+    }
+
+    void seed(unsigned int s) { gen_.seed(s); }
+
+    const SA_Params& params() const { return params_; }
+    SA_Params& params() { return params_; }
+    double temperature() const { return T_; }
+    double initial_temperature() const { return T0_; }
+    double min_temperature() const { return T_min_; }
+    int reheats() const { return reheats_; }
+    int iterations() const { return iter_; }
+    int no_improve_count() const { return noImproveCount_; }
+    const Operator_Selector& operator_stats() const { return selector_; }
+
+private:
+    // 溫度校正：從 current 取樣 calibration_samples 個鄰居，
+    // T0 = -mean(Δ+) / ln(χ0)，T_min 使最小的上坡移動以 final_accept 的機率被接受，
+    // GEOMETRIC 時 alpha 調整成剛好在 max_Iter 步內由 T0 降到 T_min
+    // budget 用完時回傳 false
+    bool calibrate(const Solution& current, double currentCost, Solution& best, double& best_Cost, Search_Budget* budget) {
+        double sum = 0.0, dmin = 0.0;
+        int uphill = 0;
+        for (int k = 0; k < params_.calibration_samples; ++k) {
+            Solution neighbor = GenerateNeighbor(current, *cfg_, gen_);
+            double cost = Solution_Function(neighbor, *cfg_).makespan;
+            double delta = cost - currentCost;
+            if (delta > 0) {
+                sum += delta;
+                dmin = uphill ? std::min(dmin, delta) : delta;
+                uphill++;
+            } else if (cost < best_Cost) {
+                best = neighbor;
+                best_Cost = cost;
+            }
+            if (budget && budget->spend(best_Cost)) return false;
+        }
+        if (uphill == 0) return true;   // 沒有上坡移動，保留 params 的溫度
+
+        T0_    = -(sum / uphill) / std::log(params_.initial_accept);
+        T_min_ = std::min(T0_, dmin / std::log(1.0 / params_.final_accept));
+        T_     = T0_;
+        int stages = std::max(1, params_.max_Iter / std::max(1, params_.iterPerTemp));
+        alpha_ = std::pow(T_min_ / T0_, 1.0 / stages);
+        return true;
+    }
+
+    // 自適應排程每步的調整倍率：預設讓 T 最快可在一半的迭代內走完 T0 -> T_min
+    double adaptive_factor() const {
+        if (params_.adapt_factor > 0) return params_.adapt_factor;
+        if (T_min_ <= 0 || T0_ <= T_min_) return 0.999;
+        return std::pow(T_min_ / T0_, 2.0 / std::max(1, params_.max_Iter));
+    }
+
+    // 搜尋進度 (0 ~ 1)：迭代數，以及 budget 的評估次數 / 時間中較快用完者
+    double progress(const Search_Budget* budget) const {
+        double p = double(iter_) / std::max(1, params_.max_Iter);
+        if (budget) {
+            if (budget->max_evals > 0)     p = std::max(p, double(budget->evals) / budget->max_evals);
+            if (budget->time_limit_ms > 0) p = std::max(p, budget->elapsed() / budget->time_limit_ms);
+        }
+        return std::min(1.0, p);
+    }
+
+    double target_acceptance(double p) const {
+        if (params_.cooling == Cooling_Schedule::LAM) return Lam_Target_Acceptance(p);
+        return params_.initial_accept * std::pow(params_.final_accept / params_.initial_accept, p);
+    }
+
+    const Config* cfg_;
+    SA_Params params_;
+    std::mt19937 gen_;
+    Operator_Selector selector_;   // 鄰域算子的 credit assignment
+
+    // ---- 執行狀態 ----
+    double T_;
+    double T0_;        // 本次 run 的初始溫度 (校正後)
+    double T_min_;
+    double alpha_;
+    int iter_;
+    int noImproveCount_;
+    int reheats_;
+};
+
+
+
+
+// Simulated Annealing (以依規模縮放的參數建立一個 engine 執行一次)
+Solution Simulated_Annealing( Config& config  , vector<double>* GB_Recorder = nullptr , vector<double>* CB_Recorder = nullptr , Search_Budget* budget = nullptr){
+    SA_Params params = Scaled_SA_Params(config);
+    params.verbose = true;
+    SA_Engine engine(config, params);
+    return engine.run(GB_Recorder, CB_Recorder, budget);
+}
+
+
+
+
+// 多條獨立 SA chain：num_threads 條執行緒分攤 num_chains 個 engine，
+// 第 i 條 chain 的種子由 base_seed 與 i 決定，結果與執行緒數無關
+std::vector<Solution> Run_Independent_SA(const Config& config, const SA_Params& params, int num_chains,
+                                         unsigned int base_seed = std::random_device{}(), int num_threads = 0) {
+    if (num_threads <= 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, std::max(1, num_chains));
+
+    std::vector<Solution> results(num_chains);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]{
+            for (int i = t; i < num_chains; i += num_threads) {
+                std::seed_seq seq{base_seed, static_cast<unsigned int>(i)};
+                unsigned int chain_seed;
+                seq.generate(&chain_seed, &chain_seed + 1);
+                SA_Engine engine(config, params, chain_seed);
+                results[i] = engine.run();
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    return results;
+}
+
+
+
+#endif
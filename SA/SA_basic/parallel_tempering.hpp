@@ -0,0 +1,235 @@
+#ifndef PARALLEL_TEMPERING_HPP
+#define PARALLEL_TEMPERING_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/barrier.hpp"
+#include "SA.hpp"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+
+
+
+// ----- Parallel Tempering (Replica Exchange) Parameters ------
+struct PT_Params {
+    int num_chains;            // M 條 chain，每條一個執行緒、一個固定溫度
+    double T_low;              // 最冷 chain 的溫度
+    double T_high;             // 最熱 chain 的初始溫度 (ladder 為等比數列)
+    int sweep_len;             // 每次交換前，每條 chain 做幾步 Metropolis
+    int num_rounds;            // 交換回合數
+    bool adaptive_ladder;      // 依交換接受率調整溫度間距
+    double target_swap_rate;   // 目標交換接受率
+    double adapt_rate;         // 間距調整速度
+    int adapt_interval;        // 每幾回合調整一次 ladder
+    bool use_Heuristic;        // 是否啟用啟發式初解
+    unsigned int seed;         // 隨機種子 (各 chain 由此衍生)
+
+    PT_Params(){
+        num_chains       = 8;
+        T_low            = 1.0;
+        T_high           = 100.0;
+        sweep_len        = 50;
+        num_rounds       = 100;
+        adaptive_ladder  = true;
+        target_swap_rate = 0.25;
+        adapt_rate       = 0.5;
+        adapt_interval   = 10;
+        use_Heuristic    = true;
+        seed             = std::random_device{}();
+    }
+};
+
+
+// 每條 chain (溫度位置) 的統計
+struct PT_Chain_Stats {
+    double temperature  = 0.0;
+    long long proposals = 0;
+    long long accepted  = 0;
+    long long swap_attempts = 0;   // 與上一層 (較熱) chain 的交換
+    long long swap_accepted = 0;
+    double best_cost    = 0.0;
+    double current_cost = 0.0;
+
+    double acceptance_rate() const { return proposals ? double(accepted) / proposals : 0.0; }
+    double swap_rate()       const { return swap_attempts ? double(swap_accepted) / swap_attempts : 0.0; }
+};
+
+
+struct PT_Result {
+    Solution best;
+    std::vector<PT_Chain_Stats> chains;
+    int rounds = 0;
+};
+
+
+inline void Show_PT_Statistics(const PT_Result& result) {
+    printf("\n%-6s %-12s %-10s %-10s %-10s %-10s\n", "chain", "T", "accept", "swap", "best", "current");
+    for (size_t k = 0; k < result.chains.size(); ++k) {
+        const PT_Chain_Stats& c = result.chains[k];
+        printf("%-6zu %-12.4f %-10.3f %-10.3f %-10.2f %-10.2f\n", k, c.temperature,
+               c.acceptance_rate(), c.swap_rate(), c.best_cost, c.current_cost);
+    }
+    printf("rounds = %d\n", result.rounds);
+}
+
+
+
+
+// 單一 replica：固定溫度下的 Metropolis chain
+struct PT_Replica {
+    Solution current;
+    Solution best;
+    std::mt19937 gen;
+    long long window_swap_attempts = 0;   // 本次 ladder 調整區間內的交換統計
+    long long window_swap_accepted = 0;
+
+    // 在溫度 T 下做 steps 步 Metropolis
+    void sweep(const Config& config, double T, int steps, PT_Chain_Stats& stats) {
+        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        for (int s = 0; s < steps; ++s) {
+            Solution neighbor = GenerateNeighbor(current, config, gen);
+            Solution_Function(neighbor, config);
+
+            double delta = neighbor.cost - current.cost;
+            stats.proposals++;
+            if (delta <= 0 || uni(gen) < std::exp(-delta / T)) {
+                current = std::move(neighbor);
+                stats.accepted++;
+                if (current.cost < best.cost) best = current;
+            }
+        }
+    }
+};
+
+
+
+
+// Parallel Tempering SA
+// M 條 chain 各在一條執行緒上以固定溫度跑 Metropolis，
+// 每 sweep_len 步後在相鄰溫度間以 Metropolis 準則交換狀態 (偶數 / 奇數對輪流)
+// budget 在每次交換時檢查 (粒度 = 一個 sweep)
+PT_Result Parallel_Tempering_SA(const Config& config, const PT_Params& params,
+                                vector<double>* GB_Recorder = nullptr,
+                                vector<double>* CB_Recorder = nullptr,
+                                Search_Budget* budget = nullptr) {
+    int M = std::max(1, params.num_chains);
+    if (budget) budget->start();
+
+    // 溫度 ladder (等比)
+    std::vector<double> temps(M);
+    for (int k = 0; k < M; ++k) {
+        double r = (M == 1) ? 0.0 : double(k) / (M - 1);
+        temps[k] = params.T_low * std::pow(params.T_high / params.T_low, r);
+    }
+
+    // 初始化 replicas (各自的引擎產生初解)
+    std::seed_seq seq{params.seed};
+    std::vector<unsigned int> seeds(M + 1);
+    seq.generate(seeds.begin(), seeds.end());
+
+    std::vector<PT_Replica> replicas(M);
+    std::vector<PT_Chain_Stats> stats(M);
+    for (int k = 0; k < M; ++k) {
+        replicas[k].gen.seed(seeds[k]);
+        replicas[k].current = GenerateInitialSolution(config, params.use_Heuristic, replicas[k].gen);
+        Solution_Function(replicas[k].current, config);
+        replicas[k].best = replicas[k].current;
+    }
+    std::mt19937 exchange_gen(seeds[M]);
+    std::uniform_real_distribution<double> uni(0.0, 1.0);
+
+    Solution global_best = replicas[0].best;
+    for (auto& r : replicas) if (r.best.cost < global_best.cost) global_best = r.best;
+    if (budget && budget->spend(global_best.cost, M)) {
+        budget->finish();
+        PT_Result result;
+        result.best = global_best;
+        return result;
+    }
+
+    std::atomic<bool> stop(false);
+    int rounds_done = 0;
+    Thread_Barrier barrier(M);
+
+    // 交換、ladder 調整、紀錄：只在 thread 0 於兩個 barrier 之間執行
+    auto exchange_step = [&](int round) {
+        for (int k = round % 2; k + 1 < M; k += 2) {
+            PT_Replica& cold = replicas[k];
+            PT_Replica& hot  = replicas[k + 1];
+            double d = (1.0 / temps[k] - 1.0 / temps[k + 1]) * (cold.current.cost - hot.current.cost);
+            stats[k].swap_attempts++;
+            cold.window_swap_attempts++;
+            if (d >= 0 || uni(exchange_gen) < std::exp(d)) {
+                std::swap(cold.current, hot.current);
+                stats[k].swap_accepted++;
+                cold.window_swap_accepted++;
+            }
+        }
+
+        // 依相鄰交換接受率調整 log 間距：太低就拉近，太高就拉開；
+        // 兩端溫度固定 (T_low, T_high)，間距重新正規化，溫度會集中到交換困難的區段
+        if (params.adaptive_ladder && M > 2 && (round + 1) % params.adapt_interval == 0) {
+            std::vector<double> gaps(M - 1);
+            double sum = 0.0;
+            for (int k = 0; k + 1 < M; ++k) {
+                double gap = std::log(temps[k + 1] / temps[k]);
+                PT_Replica& r = replicas[k];
+                if (r.window_swap_attempts > 0) {
+                    double rate = double(r.window_swap_accepted) / r.window_swap_attempts;
+                    gap *= std::exp(params.adapt_rate * (rate - params.target_swap_rate));
+                }
+                gaps[k] = std::max(1e-6, gap);
+                sum += gaps[k];
+                r.window_swap_attempts = r.window_swap_accepted = 0;
+            }
+            double span = std::log(params.T_high / params.T_low);
+            for (int k = 0; k + 1 < M; ++k) temps[k + 1] = temps[k] * std::exp(gaps[k] * span / sum);
+        }
+
+        for (auto& r : replicas) if (r.best.cost < global_best.cost) global_best = r.best;
+        if (GB_Recorder) GB_Recorder->push_back(global_best.cost);
+        if (CB_Recorder) CB_Recorder->push_back(replicas[0].current.cost);
+
+        rounds_done = round + 1;
+        if (budget && budget->spend(global_best.cost, (long long)M * params.sweep_len)) stop = true;
+    };
+
+    auto worker = [&](int k) {
+        for (int round = 0; round < params.num_rounds; ++round) {
+            replicas[k].sweep(config, temps[k], params.sweep_len, stats[k]);
+            barrier.wait();
+            if (k == 0) exchange_step(round);
+            barrier.wait();
+            if (stop) break;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(M - 1);
+    for (int k = 1; k < M; ++k) threads.emplace_back(worker, k);
+    worker(0);
+    for (auto& th : threads) th.join();
+
+    PT_Result result;
+    result.best   = global_best;
+    result.rounds = rounds_done;
+    result.chains = stats;
+    for (int k = 0; k < M; ++k) {
+        result.chains[k].temperature  = temps[k];
+        result.chains[k].best_cost    = replicas[k].best.cost;
+        result.chains[k].current_cost = replicas[k].current.cost;
+    }
+    if (budget) budget->finish();
+    return result;
+}
+
+
+
+#endif
@@ -1,5 +1,6 @@
 #include "include/modules.hpp"
 #include "tabu_search.hpp"
+#include "multi_start_ts.hpp"
 
 #include <iostream>
 #include <vector>
@@ -25,37 +26,25 @@ int main() {
     Config cfg = ReadConfigFile("../../datasets/n4_06.dag");
     
     
-    double num_loop = 5;
-
     // ----- TS Parameters ------
-
-    int maxIter       = 200;   // 最大迭代次數  
-    int tabuTenure    = 10;    // 禁忌期限  
-    int numCandidates = 60;   // 一次產生的鄰居數量  
-
-    double Avg_Cost = 0;
-    double best_cost = 100000;
-    double worst_cost = 0;
-
-    vector<double> GB,CB;
-    for(int i =0;i<num_loop;i++){
-        Solution init_S = GenerateInitialSolution(cfg , true);
-        Solution best = Tabu_Search(cfg, &init_S  ,maxIter, tabuTenure, numCandidates ,&GB,&CB);
-
-        cout << "Best makespan: " << best.cost << "\n";
-        ScheduleResult sr = Solution_Function(best, cfg , true);
-        show_solution(best);
-        cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
-        cout << "Cost : " << sr.makespan;
-        Avg_Cost+=best.cost;
-        cout<<"\n";
-
-        if (best_cost > best.cost) best_cost = best.cost;
-        if (worst_cost <  best.cost) worst_cost = best.cost;
-    }
-    printf("\n\n\nAvg Cost = %lf\n",Avg_Cost/num_loop);
-    printf("Best Cost = %lf\n",best_cost);
-    printf("Worst Cost = %lf\n",worst_cost);
+    Multi_Start_Params params;
+    params.num_starts    = 10;    // 原本的 num_loop，改為並行多起點
+    params.maxIter       = 200;   // 最大迭代次數  
+    params.tabuTenure    = 10;    // 禁忌期限  
+    params.numCandidates = 60;    // 一次產生的鄰居數量  
+    params.reactive      = true;  // Reactive TS：自動調整 tenure，避免在平原上繞圈
+    params.adaptive_moves = true; // 依改善紀錄自適應選擇 swap ss / change ms
+
+    Run_Statistics stats = Multi_Start_Tabu_Search(cfg, params);
+
+    Solution& best = stats.best_solution;
+    cout << "Best makespan: " << best.cost << "\n";
+    ScheduleResult sr = Solution_Function(best, cfg , true);
+    show_solution(best);
+    cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
+    cout << "Cost : " << sr.makespan;
+
+    Show_Statistics(stats);
      
     /*writeTwoVectorsToFile(GB,CB,"data.txt");
     Call_Py_Visual();*/
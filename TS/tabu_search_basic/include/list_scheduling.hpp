@@ -0,0 +1,450 @@
+#ifndef LIST_SCHEDULING_HPP
+#define LIST_SCHEDULING_HPP
+
+#include "config.hpp"
+#include "evaluation.hpp"
+#include "heft.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+// List Scheduling Family
+// 確定性的 list scheduler，共用 HEFT_Cache (CSR、平均成本、rank_u)、同一個 ready queue 與插入式 EFT 排程狀態：
+//   HEFT      ：rank_u 遞減，選 EFT 最小的處理器 (heft.hpp)
+//   CPOP      ：priority = rank_u + rank_d，關鍵路徑上的任務固定放在關鍵處理器，其餘選 EFT 最小 (Topcuoglu et al. 2002)
+//   PEFT      ：Optimistic Cost Table，priority = OCT 的平均，選 EFT + OCT 最小的處理器 (Arabnejad & Barbosa 2014)
+//   LOOKAHEAD ：rank_u 遞減，EFT 前幾名的處理器再往後看一步，選讓後繼最早完成的
+// 每個都是 O((T + E)·P) (加上 ready queue 的 O(T log T))；Best_List_Schedule 全跑一次取 makespan 最小者，
+// 可以當作近乎零成本的 baseline，或當作 metaheuristic 的初始解
+
+
+enum class List_Scheduler { HEFT, CPOP, PEFT, LOOKAHEAD };
+
+inline const char* List_Scheduler_Name(List_Scheduler method) {
+    switch (method) {
+        case List_Scheduler::HEFT:      return "HEFT";
+        case List_Scheduler::CPOP:      return "CPOP";
+        case List_Scheduler::PEFT:      return "PEFT";
+        case List_Scheduler::LOOKAHEAD: return "LOOKAHEAD";
+    }
+    return "?";
+}
+
+
+
+
+// ----- Ready Queue ------
+// 前驅都排完的任務放在 binary heap，priority 大者先出 (同分取拓撲序較前者)，pop 出的順序一定是拓撲序；
+// heap 元素直接帶著 (priority, 拓撲序位置)，比較時不必再去查兩個 T 大小的陣列 (入口任務很多時 heap 很大)。
+// 有環時 (不合法的輸入) heap 空了就依拓撲序補上剩下的任務，避免漏排
+class Ready_Queue {
+public:
+    void reset(const HEFT_Cache& G, const std::vector<double>& priority) {
+        G_ = &G;
+        pri_ = &priority;
+        next_ = 0;
+        indeg_.resize(G.T);
+        heap_.clear();
+        heap_.reserve(G.T);
+        for (unsigned int t = 0; t < G.T; ++t) {
+            indeg_[t] = G.pred_off[t + 1] - G.pred_off[t];
+            if (indeg_[t] == 0) heap_.push_back(entry(t));
+        }
+        std::make_heap(heap_.begin(), heap_.end(), Lower());
+    }
+
+    int pop() {
+        int t;
+        if (heap_.empty()) {
+            while (indeg_[G_->topo[next_]] < 0) ++next_;
+            t = G_->topo[next_];
+        } else {
+            std::pop_heap(heap_.begin(), heap_.end(), Lower());
+            t = heap_.back().task;
+            heap_.pop_back();
+        }
+        indeg_[t] = -1;
+        return t;
+    }
+
+    // t 排完：入度歸零的後繼進入 heap
+    void release(int t) {
+        for (int k = G_->succ_off[t]; k < G_->succ_off[t + 1]; ++k) {
+            int s = G_->succ_task[k];
+            if (indeg_[s] > 0 && --indeg_[s] == 0) {
+                heap_.push_back(entry(s));
+                std::push_heap(heap_.begin(), heap_.end(), Lower());
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        double priority;
+        int pos;                    // 拓撲序位置
+        int task;
+    };
+    // heap 的比較：a 的優先權低於 b
+    struct Lower {
+        bool operator()(const Entry& a, const Entry& b) const {
+            if (a.priority != b.priority) return a.priority < b.priority;
+            return a.pos > b.pos;
+        }
+    };
+
+    Entry entry(int t) const { return Entry{(*pri_)[t], G_->topo_pos[t], t}; }
+
+    const HEFT_Cache* G_ = nullptr;
+    const std::vector<double>* pri_ = nullptr;
+    std::vector<int> indeg_;        // 尚未排完的前驅數；-1 表示已 pop
+    std::vector<Entry> heap_;
+    size_t next_ = 0;
+};
+
+
+
+
+// ----- Schedule State ------
+// 已排任務的處理器 / 開始 / 結束時間與各處理器的時間軸 (插入式，同 HEFT)
+struct List_Schedule_State {
+    const Config* cfg = nullptr;
+    const HEFT_Cache* G = nullptr;
+    std::vector<int> ms;
+    std::vector<int> seq;                   // 排入的順序 (拓撲序)
+    std::vector<double> start, finish;
+    std::vector<double> ready;              // ready_times 的結果：目前任務在各處理器上的 ready time
+    std::vector<Processor_Timeline> timeline;
+    double makespan = 0.0;
+
+    void reset(const Config& c, const HEFT_Cache& g) {
+        cfg = &c;
+        G = &g;
+        ms.assign(g.T, 0);
+        seq.clear();
+        seq.reserve(g.T);
+        start.assign(g.T, 0.0);
+        finish.assign(g.T, 0.0);
+        ready.assign(g.P, 0.0);
+        timeline.assign(g.P, Processor_Timeline());
+        makespan = 0.0;
+    }
+
+    // t 在各處理器上的 ready time (前驅的完成時間 + 跨處理器的傳輸時間)，O(indeg · P)
+    void ready_times(int t) {
+        int P = G->P;
+        for (int p = 0; p < P; ++p) {
+            double r = 0.0;
+            for (int k = G->pred_off[t]; k < G->pred_off[t + 1]; ++k) {
+                int u = G->pred_task[k];
+                int pu = ms[u];
+                double comm = (pu != p) ? G->pred_vol[k] * cfg->theCommRate[pu][p] : 0.0;
+                r = std::max(r, finish[u] + comm);
+            }
+            ready[p] = r;
+        }
+    }
+
+    // t 放在 p 上的最早開始時間 (先呼叫 ready_times(t))；超過 finish_limit 的只是下界
+    double earliest_start(int t, int p, double finish_limit = std::numeric_limits<double>::infinity()) const {
+        return timeline[p].earliest_start(ready[p], cfg->theCompCost[t][p], finish_limit);
+    }
+
+    // EFT 最小的處理器 (先呼叫 ready_times(t))；接在時間軸最後的最早完成時間當作找空檔的上限
+    int best_eft(int t, double& bestStart) const {
+        const std::vector<double>& w = cfg->theCompCost[t];
+        int P = G->P;
+        double bound = std::numeric_limits<double>::infinity();
+        for (int p = 0; p < P; ++p)
+            bound = std::min(bound, std::max(ready[p], timeline[p].end_time()) + w[p]);
+
+        double bestFinish = std::numeric_limits<double>::infinity();
+        int bestProc = 0;
+        bestStart = 0.0;
+        for (int p = 0; p < P; ++p) {
+            double s = earliest_start(t, p, std::min(bound, bestFinish));
+            if (s + w[p] < bestFinish) {
+                bestFinish = s + w[p];
+                bestStart = s;
+                bestProc = p;
+            }
+        }
+        return bestProc;
+    }
+
+    void assign(int t, int p, double s) {
+        double f = s + cfg->theCompCost[t][p];
+        ms[t] = p;
+        start[t] = s;
+        finish[t] = f;
+        timeline[p].occupy(s, f);
+        seq.push_back(t);
+        makespan = std::max(makespan, f);
+    }
+
+    // ss 依 (開始, 結束) 時間排序，相同時依排入順序 (stable)，理由同 HEFT_Solution；cost 為本排程的 makespan
+    Solution to_solution() const {
+        Solution sol;
+        sol.ms = ms;
+        sol.ss = seq;
+        std::stable_sort(sol.ss.begin(), sol.ss.end(), [this](int a, int b) {
+            if (start[a] != start[b]) return start[a] < start[b];
+            return finish[a] < finish[b];
+        });
+        sol.cost = makespan;
+        return sol;
+    }
+};
+
+
+
+
+// ----- CPOP ------
+// rank_d(t) = max_{u ∈ pred(t)} ( rank_d(u) + avg_w(u) + avg_c(u, t) )，priority = rank_u + rank_d；
+// 關鍵路徑：從 priority 最大的入口任務出發，每步走 priority 最大的後繼 (priority 都等於 |CP|)，
+// 關鍵處理器為關鍵路徑計算時間總和最小者
+inline Solution CPOP_Solution(const Config& cfg) {
+    HEFT_Cache& G = HEFT_Cache_For(cfg);
+    int T = G.T, P = G.P;
+    if (T == 0 || P == 0) return Solution{std::vector<int>(T), std::vector<int>(T, 0), 0.0};
+
+    std::vector<double> priority(T, 0.0);      // 先存 rank_d
+    for (int t : G.topo) {
+        double head = 0.0;
+        for (int k = G.pred_off[t]; k < G.pred_off[t + 1]; ++k) {
+            int u = G.pred_task[k];
+            head = std::max(head, priority[u] + G.avg_w[u] + G.pred_vol[k] * G.avg_rate);
+        }
+        priority[t] = head;
+    }
+    for (int t = 0; t < T; ++t) priority[t] += G.rank_u[t];
+
+    auto higher = [&](int a, int b) {
+        if (priority[a] != priority[b]) return priority[a] > priority[b];
+        return G.topo_pos[a] < G.topo_pos[b];
+    };
+    std::vector<char> onCP(T, 0);
+    int cur = -1;
+    for (int t = 0; t < T; ++t)
+        if (G.pred_off[t + 1] == G.pred_off[t] && (cur < 0 || higher(t, cur))) cur = t;
+    if (cur < 0) cur = G.topo[0];
+    std::vector<double> cpCost(P, 0.0);
+    while (cur >= 0 && !onCP[cur]) {
+        onCP[cur] = 1;
+        for (int p = 0; p < P; ++p) cpCost[p] += cfg.theCompCost[cur][p];
+        int next = -1;
+        for (int k = G.succ_off[cur]; k < G.succ_off[cur + 1]; ++k)
+            if (next < 0 || higher(G.succ_task[k], next)) next = G.succ_task[k];
+        cur = next;
+    }
+    int cpProc = std::min_element(cpCost.begin(), cpCost.end()) - cpCost.begin();
+
+    List_Schedule_State S;
+    S.reset(cfg, G);
+    Ready_Queue Q;
+    Q.reset(G, priority);
+    for (int n = 0; n < T; ++n) {
+        int t = Q.pop();
+        S.ready_times(t);
+        double s;
+        int p;
+        if (onCP[t]) {
+            p = cpProc;
+            s = S.earliest_start(t, p);
+        } else {
+            p = S.best_eft(t, s);
+        }
+        S.assign(t, p, s);
+        Q.release(t);
+    }
+    return S.to_solution();
+}
+
+
+
+
+// ----- PEFT ------
+// OCT(t, p) = max_{s ∈ succ(t)} min_q ( OCT(s, q) + w(s, q) + [q ≠ p] · avg_c(t, s) )，出口任務為 0；
+// 令 A_s(q) = OCT(s, q) + w(s, q)，q ≠ p 的最小值只需要 A_s 的最小 / 次小值，整張表 O(E · P)。
+// priority = OCT(t, ·) 的平均；處理器選 EFT(t, p) + OCT(t, p) 最小者
+inline Solution PEFT_Solution(const Config& cfg) {
+    HEFT_Cache& G = HEFT_Cache_For(cfg);
+    int T = G.T, P = G.P;
+    if (T == 0 || P == 0) return Solution{std::vector<int>(T), std::vector<int>(T, 0), 0.0};
+
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<double> oct((size_t)T * P, 0.0);
+    std::vector<double> min1(T), min2(T);       // A_s 的最小 / 次小值
+    std::vector<int> arg1(T);
+    std::vector<double> priority(T);
+    for (int i = T - 1; i >= 0; --i) {
+        int t = G.topo[i];
+        double* row = &oct[(size_t)t * P];
+        for (int k = G.succ_off[t]; k < G.succ_off[t + 1]; ++k) {
+            int s = G.succ_task[k];
+            const double* A = &oct[(size_t)s * P];
+            const std::vector<double>& ws = cfg.theCompCost[s];
+            double c = G.succ_vol[k] * G.avg_rate;
+            for (int p = 0; p < P; ++p) {
+                double other = (p == arg1[s] ? min2[s] : min1[s]) + c;
+                row[p] = std::max(row[p], std::min(A[p] + ws[p], other));
+            }
+        }
+
+        const std::vector<double>& w = cfg.theCompCost[t];
+        double sum = 0.0;
+        min1[t] = min2[t] = inf;
+        arg1[t] = -1;
+        for (int p = 0; p < P; ++p) {
+            sum += row[p];
+            double a = row[p] + w[p];
+            if (a < min1[t]) { min2[t] = min1[t]; min1[t] = a; arg1[t] = p; }
+            else if (a < min2[t]) min2[t] = a;
+        }
+        priority[t] = sum / P;
+    }
+
+    List_Schedule_State S;
+    S.reset(cfg, G);
+    Ready_Queue Q;
+    Q.reset(G, priority);
+    for (int n = 0; n < T; ++n) {
+        int t = Q.pop();
+        S.ready_times(t);
+        const std::vector<double>& w = cfg.theCompCost[t];
+        const double* row = &oct[(size_t)t * P];
+        // 接在時間軸最後一定可行，其中 EFT + OCT 最小者當作初始答案；
+        // 之後 EFT 超過 best - OCT 的處理器贏不了，找空檔時提早放棄 (回傳值只是下界，跳過)
+        double best = inf, bestStart = 0.0;
+        int bestProc = 0;
+        for (int p = 0; p < P; ++p) {
+            double s = std::max(S.ready[p], S.timeline[p].end_time());
+            double v = s + w[p] + row[p];
+            if (v < best) {
+                best = v;
+                bestStart = s;
+                bestProc = p;
+            }
+        }
+        for (int p = 0; p < P; ++p) {
+            double limit = best - row[p];
+            double s = S.earliest_start(t, p, limit);
+            if (s + w[p] > limit) continue;
+            double v = s + w[p] + row[p];
+            if (v < best) {
+                best = v;
+                bestStart = s;
+                bestProc = p;
+            }
+        }
+        S.assign(t, bestProc, bestStart);
+        Q.release(t);
+    }
+    return S.to_solution();
+}
+
+
+
+
+// ----- Lookahead ------
+// rank_u 遞減；EFT 前 width 名的處理器各自估計「放在這裡之後，後繼最晚的最早完成時間」：
+//   score(p) = max_{s ∈ succ(t)} min_q ( max(EFT(t, p) + [q ≠ p] · vol · rate(p, q), avail(q)) + w(s, q) )
+// avail(q) 為 q 時間軸的結尾 (q = p 時再與 EFT(t, p) 取大)，不考慮 s 的其他前驅；沒有後繼時 score = EFT。
+// 選 score 最小者 (同分取 EFT 較小、編號較小)，每個任務 O(P + width · outdeg · P)
+inline Solution Lookahead_Solution(const Config& cfg, int width = 2) {
+    HEFT_Cache& G = HEFT_Cache_For(cfg);
+    int T = G.T, P = G.P;
+    if (T == 0 || P == 0) return Solution{std::vector<int>(T), std::vector<int>(T, 0), 0.0};
+    width = std::max(1, std::min(width, P));
+
+    List_Schedule_State S;
+    S.reset(cfg, G);
+    Ready_Queue Q;
+    Q.reset(G, G.rank_u);
+    std::vector<double> st(P), ft(P), avail(P);
+    std::vector<int> cand(P);
+    for (int n = 0; n < T; ++n) {
+        int t = Q.pop();
+        S.ready_times(t);
+        const std::vector<double>& w = cfg.theCompCost[t];
+        // 接在最後的完成時間中第 width 小者 >= 真正 EFT 的第 width 小者，超過它的處理器進不了前 width 名
+        for (int p = 0; p < P; ++p) {
+            avail[p] = S.timeline[p].end_time();
+            ft[p] = std::max(S.ready[p], avail[p]) + w[p];
+        }
+        std::nth_element(ft.begin(), ft.begin() + (width - 1), ft.end());
+        double limit = ft[width - 1];
+        for (int p = 0; p < P; ++p) {
+            st[p] = S.earliest_start(t, p, limit);
+            ft[p] = st[p] + w[p];
+            cand[p] = p;
+        }
+        std::partial_sort(cand.begin(), cand.begin() + width, cand.end(), [&ft](int a, int b) {
+            if (ft[a] != ft[b]) return ft[a] < ft[b];
+            return a < b;
+        });
+
+        int bestProc = cand[0];
+        double bestScore = std::numeric_limits<double>::infinity();
+        for (int i = 0; i < width; ++i) {
+            int p = cand[i];
+            double score = ft[p];
+            for (int k = G.succ_off[t]; k < G.succ_off[t + 1] && score < bestScore; ++k) {
+                int s = G.succ_task[k];
+                const std::vector<double>& ws = cfg.theCompCost[s];
+                double childBest = std::numeric_limits<double>::infinity();
+                for (int q = 0; q < P; ++q) {
+                    double arrive = (q == p) ? ft[p] : ft[p] + G.succ_vol[k] * cfg.theCommRate[p][q];
+                    double a = (q == p) ? std::max(avail[q], ft[p]) : avail[q];
+                    childBest = std::min(childBest, std::max(arrive, a) + ws[q]);
+                }
+                score = std::max(score, childBest);
+            }
+            // cand 依 EFT 排序，同分時前面的 EFT 較小
+            if (score < bestScore) {
+                bestScore = score;
+                bestProc = p;
+            }
+        }
+        S.assign(t, bestProc, st[bestProc]);
+        Q.release(t);
+    }
+    return S.to_solution();
+}
+
+
+
+
+// ----- Driver ------
+inline Solution List_Schedule(const Config& cfg, List_Scheduler method) {
+    switch (method) {
+        case List_Scheduler::CPOP:      return CPOP_Solution(cfg);
+        case List_Scheduler::PEFT:      return PEFT_Solution(cfg);
+        case List_Scheduler::LOOKAHEAD: return Lookahead_Solution(cfg);
+        default:                        return HEFT_Solution(cfg);
+    }
+}
+
+// 四種全跑，以 Calculate_schedule 的 makespan (metaheuristic 看到的 cost，不超過各自排程的 makespan) 取最小，
+// 同分取列舉順序較前者；回傳解的 cost 即為該 makespan。
+// winner / makespans 不為 nullptr 時寫入勝出的方法與各方法的 makespan (依 List_Scheduler 順序)
+inline Solution Best_List_Schedule(const Config& cfg, List_Scheduler* winner = nullptr,
+                                   std::vector<double>* makespans = nullptr) {
+    const List_Scheduler methods[] = { List_Scheduler::HEFT, List_Scheduler::CPOP,
+                                       List_Scheduler::PEFT, List_Scheduler::LOOKAHEAD };
+    Solution best;
+    best.cost = std::numeric_limits<double>::infinity();
+    if (makespans) makespans->clear();
+    for (List_Scheduler m : methods) {
+        Solution sol = List_Schedule(cfg, m);
+        sol.cost = Calculate_schedule(sol.ss, sol.ms, cfg).makespan;
+        if (makespans) makespans->push_back(sol.cost);
+        if (sol.cost < best.cost) {
+            best = std::move(sol);
+            if (winner) *winner = m;
+        }
+    }
+    return best;
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef OPERATOR_SELECTOR_HPP
+#define OPERATOR_SELECTOR_HPP
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+// 鄰域算子的選擇策略
+enum class Selector_Strategy {
+    UNIFORM,            // 均勻隨機 (原本的 rng() % K)
+    ADAPTIVE_PURSUIT,   // Adaptive Pursuit (Thierens 2005)
+    UCB                 // UCB1 多臂吃角子老虎
+};
+
+
+// Operator Selector (Credit Assignment)
+// 記錄每個算子「每次評估帶來的改善」，依策略偏向有效的算子
+// 與演算法無關：SA / TS / WOA 只要有 K 個算子都可以使用
+class Operator_Selector {
+public:
+    struct Op_Stats {
+        long long uses = 0;          // 被選中次數
+        long long evals = 0;         // 花掉的評估次數
+        long long improvements = 0;  // 帶來改善的次數
+        double total_gain = 0.0;     // 累積 (相對) 改善
+        double quality = 0.0;        // 估計的平均報酬 Q
+        double probability = 0.0;    // Adaptive Pursuit 的選擇機率
+    };
+
+    Operator_Selector(int num_ops = 1, Selector_Strategy strategy = Selector_Strategy::ADAPTIVE_PURSUIT,
+                      double p_min = 0.05, double alpha = 0.3, double beta = 0.3, double ucb_c = 0.1)
+        : strategy_(strategy), p_min_(p_min), alpha_(alpha), beta_(beta), ucb_c_(ucb_c), total_uses_(0)
+    {
+        reset(num_ops);
+    }
+
+    void reset(int num_ops) {
+        K_ = std::max(1, num_ops);
+        ops_.assign(K_, Op_Stats());
+        for (auto& op : ops_) op.probability = 1.0 / K_;
+        total_uses_ = 0;
+        r_max_ = 0.0;
+        if (K_ * p_min_ > 1.0) p_min_ = 1.0 / K_;
+    }
+
+    void set_strategy(Selector_Strategy s) { strategy_ = s; }
+    Selector_Strategy strategy() const { return strategy_; }
+
+    // 選一個算子
+    template <typename Engine>
+    int select(Engine& gen) {
+        int op = 0;
+        if (strategy_ == Selector_Strategy::UNIFORM || K_ == 1) {
+            op = static_cast<int>(gen() % K_);
+        } else if (strategy_ == Selector_Strategy::ADAPTIVE_PURSUIT) {
+            std::uniform_real_distribution<double> uni(0.0, 1.0);
+            double r = uni(gen), acc = 0.0;
+            op = K_ - 1;
+            for (int k = 0; k < K_; ++k) {
+                acc += ops_[k].probability;
+                if (r < acc) { op = k; break; }
+            }
+        } else {
+            // UCB1：先把每個算子都試一次
+            double best_score = -1.0;
+            for (int k = 0; k < K_; ++k) {
+                if (ops_[k].uses == 0) { op = k; best_score = -1.0; break; }
+                // 平均報酬以目前看過的最大報酬正規化到 [0,1]
+                double mean  = ops_[k].evals ? ops_[k].total_gain / ops_[k].evals : 0.0;
+                double score = (r_max_ > 0 ? mean / r_max_ : 0.0)
+                             + ucb_c_ * std::sqrt(2.0 * std::log((double)total_uses_) / ops_[k].uses);
+                if (score > best_score) { best_score = score; op = k; }
+            }
+        }
+        ops_[op].uses++;
+        total_uses_++;
+        return op;
+    }
+
+    // 回報算子 op 的結果：gain = 相對改善 (old - new) / old，evals = 花掉的評估次數
+    void reward(int op, double gain, long long evals = 1) {
+        Op_Stats& s = ops_[op];
+        double r = std::max(0.0, gain) / std::max<long long>(1, evals);
+        s.evals += evals;
+        if (gain > 0) { s.improvements++; s.total_gain += gain; }
+        s.quality += alpha_ * (r - s.quality);
+        r_max_ = std::max(r_max_, r);
+
+        if (strategy_ == Selector_Strategy::ADAPTIVE_PURSUIT) {
+            int best = 0;
+            for (int k = 1; k < K_; ++k) if (ops_[k].quality > ops_[best].quality) best = k;
+            double p_max = 1.0 - (K_ - 1) * p_min_;
+            for (int k = 0; k < K_; ++k) {
+                double target = (k == best) ? p_max : p_min_;
+                ops_[k].probability += beta_ * (target - ops_[k].probability);
+            }
+        }
+    }
+
+    int size() const { return K_; }
+    const std::vector<Op_Stats>& stats() const { return ops_; }
+
+    void show(const std::vector<std::string>& names = {}) const {
+        printf("\n%-16s %-8s %-8s %-8s %-10s %-10s\n", "operator", "uses", "improve", "prob", "quality", "gain/eval");
+        for (int k = 0; k < K_; ++k) {
+            const Op_Stats& s = ops_[k];
+            std::string name = (k < (int)names.size()) ? names[k] : ("op " + std::to_string(k));
+            printf("%-16s %-8lld %-8lld %-8.3f %-10.5f %-10.5f\n", name.c_str(), s.uses, s.improvements,
+                   s.probability, s.quality, s.evals ? s.total_gain / s.evals : 0.0);
+        }
+    }
+
+private:
+    Selector_Strategy strategy_;
+    int K_;
+    double p_min_;     // Adaptive Pursuit 最低機率
+    double alpha_;     // Q 的學習率
+    double beta_;      // 機率的追趕速度
+    double ucb_c_;     // UCB 探索係數
+    long long total_uses_;
+    double r_max_ = 0.0;   // 看過的最大單次報酬 (UCB 正規化用)
+    std::vector<Op_Stats> ops_;
+};
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef MULTI_START_TS_HPP
+#define MULTI_START_TS_HPP
+
+#include "include/modules.hpp"
+#include "include/thread_pool.hpp"
+#include "tabu_search.hpp"
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+
+
+
+// ----- Multi-Start TS Parameters ------
+struct Multi_Start_Params {
+    int num_starts;        // 總共幾次 Tabu Search (原本 main 的 num_loop)
+    int num_threads;       // 0 = hardware_concurrency
+    int maxIter;           // 每次 TS 的最大迭代次數
+    int tabuTenure;        // 禁忌期限
+    int numCandidates;     // 一次產生的鄰居數量
+    bool use_Heuristic;    // 第一輪起點是否用啟發式初解
+    int elite_capacity;    // 共享精英池大小上限
+    int diversify_moves;   // 從精英重啟時的隨機擾動次數
+    bool reactive;         // 每次 TS 使用 Reactive TS (TS_Options 預設值)
+    bool adaptive_moves;   // 每次 TS 依改善紀錄自適應選擇移動
+    std::function<Solution(const Config&)> initial;   // 精英池為空時的起點 (例如 GA / WOA 的結果)，空的就用 GenerateInitialSolution
+
+    Multi_Start_Params(){
+        num_starts      = 10;
+        num_threads     = 0;
+        maxIter         = 200;
+        tabuTenure      = 10;
+        numCandidates   = 60;
+        use_Heuristic   = true;
+        elite_capacity  = 8;
+        diversify_moves = 4;
+        reactive        = false;
+        adaptive_moves  = false;
+    }
+};
+
+
+
+
+// 多次執行的統計結果 (Avg / Best / Worst / StdDev)
+struct Run_Statistics {
+    int runs = 0;
+    double avg_cost   = 0.0;
+    double best_cost  = std::numeric_limits<double>::infinity();
+    double worst_cost = 0.0;
+    double stddev     = 0.0;
+    double wall_ms    = 0.0;
+    Solution best_solution;
+    std::vector<double> costs;   // 每一次 run 的最佳 makespan
+    int elite_restarts = 0;      // 從精英池重啟的 start 數
+};
+
+inline void Summarize_Runs(Run_Statistics& stats) {
+    stats.runs = static_cast<int>(stats.costs.size());
+    if (stats.runs == 0) return;
+
+    double sum = 0.0;
+    for (double c : stats.costs) {
+        sum += c;
+        stats.best_cost  = std::min(stats.best_cost, c);
+        stats.worst_cost = std::max(stats.worst_cost, c);
+    }
+    stats.avg_cost = sum / stats.runs;
+
+    double var = 0.0;
+    for (double c : stats.costs) var += (c - stats.avg_cost) * (c - stats.avg_cost);
+    stats.stddev = std::sqrt(var / stats.runs);
+}
+
+inline void Show_Statistics(const Run_Statistics& stats) {
+    printf("\n\n\nRuns      = %d\n", stats.runs);
+    printf("Avg Cost  = %lf\n", stats.avg_cost);
+    printf("Best Cost = %lf\n", stats.best_cost);
+    printf("Worst Cost= %lf\n", stats.worst_cost);
+    printf("Std Dev   = %lf\n", stats.stddev);
+    printf("Wall Time = %lf ms\n", stats.wall_ms);
+    printf("Elite Restarts = %d\n", stats.elite_restarts);
+}
+
+
+
+
+// 共享精英池：容量固定，依 cost 由小到大排序，不收重複解
+class Elite_Pool {
+public:
+    explicit Elite_Pool(int capacity) : capacity_(capacity) {}
+
+    // 嘗試放入精英池，回傳是否被接受
+    bool offer(const Solution& sol) {
+        std::lock_guard<std::mutex> lock(m_);
+        for (const auto& e : elites_) {
+            if (e.cost == sol.cost && e.ss == sol.ss && e.ms == sol.ms) return false;
+        }
+        if ((int)elites_.size() >= capacity_ && sol.cost >= elites_.back().cost) return false;
+
+        auto pos = std::upper_bound(elites_.begin(), elites_.end(), sol,
+            [](const Solution& a, const Solution& b){ return a.cost < b.cost; });
+        elites_.insert(pos, sol);
+        if ((int)elites_.size() > capacity_) elites_.pop_back();
+        return true;
+    }
+
+    // 隨機取一個精英 (複本)，池為空時回傳 false
+    bool pick(Solution& out) {
+        std::lock_guard<std::mutex> lock(m_);
+        if (elites_.empty()) return false;
+        std::uniform_int_distribution<int> dist(0, (int)elites_.size() - 1);
+        out = elites_[dist(rng)];
+        return true;
+    }
+
+    int size() {
+        std::lock_guard<std::mutex> lock(m_);
+        return (int)elites_.size();
+    }
+
+private:
+    int capacity_;
+    std::mutex m_;
+    std::vector<Solution> elites_;
+};
+
+
+
+
+// 從精英解出發做隨機擾動 (swap ss / change ms)，不做評估，交給 Tabu_Search 評估
+inline Solution Diversify_Elite(const Solution& elite, const Config& cfg, int moves) {
+    Solution s = elite;
+    int T = cfg.theTCount;
+    int P = cfg.thePCount;
+    std::uniform_int_distribution<int> distT(0, T - 1);
+    std::uniform_int_distribution<int> distP(0, P - 1);
+    for (int k = 0; k < moves; ++k) {
+        if (rng() % 2 == 0 && T > 1) {
+            int i = distT(rng), j = distT(rng);
+            std::swap(s.ss[i], s.ss[j]);
+        } else {
+            s.ms[distT(rng)] = distP(rng);
+        }
+    }
+    return s;
+}
+
+
+
+
+// Multi-Start Tabu Search
+// 同時跑 num_starts 次 Tabu Search：一開始就提交 min(執行緒數, num_starts) 個 worker，
+// 每個 worker 以 next_start 領下一個 start 的編號，領完就結束 (不會有閒置的執行緒)。
+// 精英池還是空的時候從初解 (params.initial 或 GenerateInitialSolution) 出發，
+// 池裡有解之後就從共享精英池挑一個解擾動後重啟
+Run_Statistics Multi_Start_Tabu_Search(const Config& cfg, const Multi_Start_Params& params) {
+    auto wall_start = std::chrono::steady_clock::now();
+
+    Run_Statistics stats;
+    stats.costs.assign(params.num_starts, 0.0);
+    std::vector<Solution> results(params.num_starts);
+
+    Elite_Pool elites(params.elite_capacity);
+    Work_Stealing_Pool pool(params.num_threads > 0 ? params.num_threads : 0);
+    std::atomic<int> next_start(0);
+    std::atomic<int> elite_restarts(0);
+
+    auto run_start = [&](int s) {
+        Solution init, elite;
+        if (elites.pick(elite)) {
+            init = Diversify_Elite(elite, cfg, params.diversify_moves);
+            elite_restarts++;
+        } else if (params.initial) {
+            init = params.initial(cfg);
+        } else {
+            init = GenerateInitialSolution(cfg, params.use_Heuristic);
+        }
+
+        TS_Options options;
+        options.reactive       = params.reactive;
+        options.cache_costs    = params.reactive;
+        options.adaptive_moves = params.adaptive_moves;
+        bool use_options = params.reactive || params.adaptive_moves;
+        Solution best = Tabu_Search(cfg, &init, params.maxIter, params.tabuTenure, params.numCandidates,
+                                    nullptr, nullptr, use_options ? &options : nullptr);
+        elites.offer(best);
+
+        stats.costs[s] = best.cost;
+        results[s]     = std::move(best);
+    };
+
+    int workers = std::min<int>(pool.size(), params.num_starts);
+    for (int w = 0; w < workers; ++w) {
+        pool.submit([&]{
+            for (int s = next_start.fetch_add(1); s < params.num_starts; s = next_start.fetch_add(1))
+                run_start(s);
+        });
+    }
+    pool.wait_idle();
+    stats.elite_restarts = elite_restarts.load();
+
+    Summarize_Runs(stats);
+    for (auto& r : results) {
+        if (r.cost == stats.best_cost) { stats.best_solution = r; break; }
+    }
+
+    auto wall_end = std::chrono::steady_clock::now();
+    stats.wall_ms = std::chrono::duration<double, std::milli>(wall_end - wall_start).count();
+    return stats;
+}
+
+
+
+#endif
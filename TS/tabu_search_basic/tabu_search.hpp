@@ -1,6 +1,14 @@
+#ifndef TABU_SEARCH_HPP
+#define TABU_SEARCH_HPP
+
 #include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/operator_selector.hpp"
 #include <deque>
 #include <utility>   
+#include <unordered_map>
+#include <cstdint>
+#include <cmath>
 
 
 
@@ -22,6 +30,8 @@ enum MoveType {
     SWAP_SS,       
     CHANGE_MS
 };
+const int TS_NUM_MOVES = 2;
+const std::vector<std::string> TS_MOVE_NAMES = { "swap ss", "change ms" };
 
 struct Move {
     MoveType type;
@@ -48,18 +58,24 @@ struct NeighborInfo {
     Solution solution;   
     Move move;          
     double cost;        
+    bool cached = false;   // cost 來自快取 (solution 尚未經 Solution_Function 修正)
 };
 
 
 
 
-NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg) {
+// evaluate = false 時只產生鄰居，不計算 cost (cost = -1)，交給呼叫端決定要不要評估
+// move_type = -1 時隨機選擇移動 (原本的行為)，否則使用指定的 MoveType
+NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg, bool evaluate = true, int move_type = -1) {
     Solution neighbor = current;      
     int T = cfg.theTCount;
     int P = cfg.thePCount;
 
-    std::uniform_int_distribution<int> moveDist(0, 1);
-    int choice = moveDist(rng);
+    int choice = move_type;
+    if (choice < 0) {
+        std::uniform_int_distribution<int> moveDist(0, 1);
+        choice = moveDist(rng);
+    }
 
     Move m;
     if (choice == 0) {
@@ -87,11 +103,124 @@ NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg)
     }
 
     
-    double c = Evaluate(neighbor, cfg);
+    double c = evaluate ? Evaluate(neighbor, cfg) : -1.0;
 
     return NeighborInfo{ neighbor, m, c };
 }
 
+
+
+// ----- Reactive TS ------
+
+// Solution 指紋 (64-bit)：ss 與 ms 的雜湊，用來偵測重複造訪
+inline uint64_t Solution_Fingerprint(const Solution& sol) {
+    uint64_t h = 1469598103934665603ULL;   // FNV offset basis
+    auto mix = [&h](uint64_t v) {
+        v += 0x9E3779B97F4A7C15ULL;
+        v = (v ^ (v >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        v = (v ^ (v >> 27)) * 0x94D049BB133111EBULL;
+        h = (h ^ (v ^ (v >> 31))) * 1099511628211ULL;
+    };
+    for (int t : sol.ss) mix(static_cast<uint64_t>(t));
+    mix(0xFFFFFFFFULL);                     // ss / ms 分隔
+    for (int p : sol.ms) mix(static_cast<uint64_t>(p));
+    return h;
+}
+
+
+// Reactive TS 選項 (傳 nullptr 給 Tabu_Search 則維持固定 tabuTenure)
+struct TS_Options {
+    bool reactive;            // 啟用 reactive tenure + cycle detection
+    bool cache_costs;         // 用指紋快取已評估過的鄰居 cost，避免重複評估
+    double tenure_increase;   // 偵測到 cycling 時 tenure 乘上此值
+    double tenure_decrease;   // 長時間無重複時 tenure 乘上此值
+    int min_tenure;
+    int max_tenure;
+    int cycle_window;         // 重複間隔小於此值視為 cycling
+    int stable_iters;         // 連續多少輪無重複就縮短 tenure
+    int escape_repetitions;   // 同一解重複次數超過此值就觸發 escape
+    int escape_moves;         // escape 時的隨機移動次數 (依長期頻率挑少用的移動)
+    bool adaptive_moves;      // 依各移動的改善紀錄選擇 swap ss / change ms (見 Operator_Selector)
+    Selector_Strategy move_strategy;
+
+    // ---- 統計 (輸出) ----
+    int cache_hits;
+    int escapes;
+    int final_tenure;
+    Operator_Selector move_selector;   // adaptive_moves 時各移動的統計
+
+    TS_Options(){
+        reactive           = true;
+        cache_costs        = true;
+        tenure_increase    = 1.1;
+        tenure_decrease    = 0.9;
+        min_tenure         = 2;
+        max_tenure         = 50;
+        cycle_window       = 50;
+        stable_iters       = 30;
+        escape_repetitions = 3;
+        escape_moves       = 4;
+        adaptive_moves     = false;
+        move_strategy      = Selector_Strategy::ADAPTIVE_PURSUIT;
+        cache_hits         = 0;
+        escapes            = 0;
+        final_tenure       = 0;
+    }
+};
+
+
+// 長期記憶：task-processor 指派頻率、task 參與 swap 的頻率
+struct Move_Frequency {
+    int P = 0;
+    std::vector<int> ms_freq;     // [t * P + p]
+    std::vector<int> swap_freq;   // [t]
+
+    Move_Frequency(int T, int P_) : P(P_), ms_freq(T * P_, 0), swap_freq(T, 0) {}
+
+    void record(const Solution& before, const Move& m) {
+        if (m.type == SWAP_SS) {
+            swap_freq[before.ss[m.i]]++;
+            swap_freq[before.ss[m.j]]++;
+        } else {
+            ms_freq[m.t * P + m.new_P]++;
+        }
+    }
+};
+
+
+// Escape：依長期頻率做 escape_moves 次「最少用」的移動
+inline void Reactive_Escape(Solution& sol, const Config& cfg, Move_Frequency& freq, int moves) {
+    int T = cfg.theTCount;
+    int P = cfg.thePCount;
+    std::uniform_int_distribution<int> distT(0, T - 1);
+    const int samples = 4;   // 每次從幾個隨機候選中挑頻率最低者
+
+    for (int k = 0; k < moves; ++k) {
+        if (rng() % 2 == 0 && T > 1) {
+            int bi = -1, bj = -1, bestF = std::numeric_limits<int>::max();
+            for (int s = 0; s < samples; ++s) {
+                int i = distT(rng), j = distT(rng);
+                if (i == j) continue;
+                int f = freq.swap_freq[sol.ss[i]] + freq.swap_freq[sol.ss[j]];
+                if (f < bestF) { bestF = f; bi = i; bj = j; }
+            }
+            if (bi < 0) continue;
+            freq.swap_freq[sol.ss[bi]]++;
+            freq.swap_freq[sol.ss[bj]]++;
+            std::swap(sol.ss[bi], sol.ss[bj]);
+        } else {
+            int t = distT(rng);
+            int bestP = sol.ms[t], bestF = std::numeric_limits<int>::max();
+            for (int p = 0; p < P; ++p) {
+                if (p == sol.ms[t]) continue;
+                if (freq.ms_freq[t * P + p] < bestF) { bestF = freq.ms_freq[t * P + p]; bestP = p; }
+            }
+            freq.ms_freq[t * P + bestP]++;
+            sol.ms[t] = bestP;
+        }
+    }
+}
+
 //-------------------------------
 
 
@@ -109,6 +238,10 @@ public:
     // 建構：傳進 tabuTenure（正整數），代表每個 Move 在禁忌清單中保留多少輪
     Tabu_List(int tabuTenure) : maxTenure(tabuTenure) {}
 
+    // Reactive TS 用：調整之後加入的 Move 的期限
+    void set_tenure(int tabuTenure) { maxTenure = tabuTenure; }
+    int  tenure() const { return maxTenure; }
+
     // (1) 把一個 Move 加入禁忌
     void add(const Move& m) {
         // 如果 Tabu List 中已有相同的 Move，只要把它的期限重設即可
@@ -166,28 +299,77 @@ private:
 
 
 // 主 Tabu Search 演算法
-Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr) {
+// options 不為 nullptr 時啟用 Reactive TS (見 TS_Options)
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// Initial_Solution 為 nullptr 時由 GenerateInitialSolution 產生起點 (use_Heuristic = true 用 HEFT 解)
+Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr , TS_Options* options = nullptr , Search_Budget* budget = nullptr , bool use_Heuristic = false) {
+    if (budget) budget->start();
+
     // INITIAL SOLUTION
     Solution  current;
-    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, false);
+    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, use_Heuristic);
     else                                current      = *Initial_Solution;
 
     double currentCost    = Evaluate(current, cfg);
     Solution bestSolution = current;
     double bestCost       = currentCost;
+    if (budget && budget->spend(bestCost)) {
+        budget->finish();
+        return bestSolution;
+    }
 
     // Tabu List
     Tabu_List tabuList(tabuTenure);
 
+    // Reactive 記憶體
+    bool reactive = (options && options->reactive);
+    bool caching  = (options && options->cache_costs);
+    std::unordered_map<uint64_t, std::pair<int,int>> visited;   // 指紋 -> (上次造訪 iter, 造訪次數)
+    std::unordered_map<uint64_t, double> costCache;             // 鄰居指紋 (修正前) -> cost
+    Move_Frequency freq(cfg.theTCount, cfg.thePCount);
+    double tenure = tabuTenure;
+    int lastTenureChange = 0;
+    if (reactive) visited[Solution_Fingerprint(current)] = {0, 1};
+
+    // Adaptive 移動選擇
+    Operator_Selector* selector = nullptr;
+    if (options && options->adaptive_moves) {
+        selector = &options->move_selector;
+        selector->reset(TS_NUM_MOVES);
+        selector->set_strategy(options->move_strategy);
+    }
+
     // Iteration
     for (int iter = 0; iter < maxIter; ++iter) {
         // Generate Neighbors
         std::vector<NeighborInfo> candidates;
         candidates.reserve(numCandidates);
         for (int k = 0; k < numCandidates; ++k) {
-            NeighborInfo ni = Tabu_Generate_Neighbor(current, cfg);
-            candidates.push_back(ni);
+            if (budget && budget->stopped()) break;
+            int move = selector ? selector->select(rng) : -1;
+            if (!caching) {
+                candidates.push_back(Tabu_Generate_Neighbor(current, cfg, true, move));
+                if (budget) budget->spend(std::min(bestCost, candidates.back().cost));
+                if (selector) selector->reward(move, (currentCost - candidates.back().cost) / currentCost);
+                continue;
+            }
+            // 已評估過的鄰居直接用快取的 cost
+            NeighborInfo ni = Tabu_Generate_Neighbor(current, cfg, false, move);
+            uint64_t key = Solution_Fingerprint(ni.solution);
+            auto hit = costCache.find(key);
+            if (hit != costCache.end()) {
+                ni.cost = ni.solution.cost = hit->second;
+                ni.cached = true;
+                options->cache_hits++;
+            } else {
+                ni.cost = Evaluate(ni.solution, cfg);
+                costCache.emplace(key, ni.cost);
+                if (budget) budget->spend(std::min(bestCost, ni.cost));
+            }
+            if (selector) selector->reward(move, (currentCost - ni.cost) / currentCost, ni.cached ? 0 : 1);
+            candidates.push_back(std::move(ni));
         }
+        if (candidates.empty()) break;
 
         // 選出最佳非禁忌或符合 Aspiration 的
         bool found = false;
@@ -210,12 +392,54 @@ Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  ,
             );
         }
 
+        // 快取命中的鄰居被選中時還要評估一次，budget 已用完就不套用這一步
+        if (chosen.cached && budget && budget->stopped()) break;
+
         //  更新 Tabu List
         tabuList.add(chosen.move);
+        if (reactive) freq.record(current, chosen.move);
 
         /// 更新 current
         current     = chosen.solution;
         currentCost = chosen.cost;
+        // 快取命中的鄰居尚未經過 Solution_Function 修正，被選中時才修正
+        if (chosen.cached) {
+            currentCost = Evaluate(current, cfg);
+            if (budget) budget->spend(std::min(bestCost, currentCost));
+        }
+
+        // Reactive：cycle detection + tenure 自動調整 + escape
+        if (reactive) {
+            uint64_t fp = Solution_Fingerprint(current);
+            auto it = visited.find(fp);
+            if (it != visited.end()) {
+                int gap = iter + 1 - it->second.first;
+                it->second.first = iter + 1;
+                it->second.second++;
+
+                if (it->second.second > options->escape_repetitions) {
+                    // 一直繞回同一解：依長期頻率跳離 (budget 已用完就不跳，迴圈結尾會結束)
+                    if (!budget || !budget->stopped()) {
+                        Reactive_Escape(current, cfg, freq, options->escape_moves);
+                        currentCost = Evaluate(current, cfg);
+                        if (budget) budget->spend(std::min(bestCost, currentCost));
+                        it->second.second = 0;
+                        options->escapes++;
+                    }
+                } else if (gap < options->cycle_window) {
+                    tenure = std::min<double>(options->max_tenure, tenure * options->tenure_increase + 1.0);
+                    lastTenureChange = iter;
+                }
+            } else {
+                visited.emplace(fp, std::make_pair(iter + 1, 1));
+            }
+
+            if (iter - lastTenureChange > options->stable_iters) {
+                tenure = std::max<double>(options->min_tenure, tenure * options->tenure_decrease);
+                lastTenureChange = iter;
+            }
+            tabuList.set_tenure(static_cast<int>(std::lround(tenure)));
+        }
 
         // 更新 best
         if (currentCost < bestCost) {
@@ -233,7 +457,14 @@ Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  ,
                       << " CurrentCost=" << currentCost
                       << " BestCost=" << bestCost << std::endl;
         }*/
+
+        // Budget 用完：部分候選已經處理過，直接回傳目前最佳
+        if (budget && budget->stopped()) break;
     }
 
+    if (options) options->final_tenure = tabuList.tenure();
+    if (budget)  budget->finish();
     return bestSolution;
 }
+
+#endif
@@ -1,4 +1,5 @@
 #include "include/modules.hpp"
+#include "include/list_scheduling.hpp"
 #include "tabu_search.hpp"
 
 #include <iostream>
@@ -33,8 +34,13 @@ int main() {
 
     vector<double> GB,CB;
     for(int i =0;i<num_loop;i++){
-        Solution best = GenerateInitialSolution(cfg,true);
-        
+        // List scheduling 家族 (HEFT / CPOP / PEFT / Lookahead) 全跑，取 makespan 最小者
+        List_Scheduler winner;
+        vector<double> makespans;
+        Solution best = Best_List_Schedule(cfg, &winner, &makespans);
+        for (int m = 0; m < (int)makespans.size(); ++m)
+            printf("%-10s %lf\n", List_Scheduler_Name((List_Scheduler)m), makespans[m]);
+        cout << "Winner: " << List_Scheduler_Name(winner) << "\n";
        
         ScheduleResult sr = Solution_Function(best, cfg , true);
         cout << "Best makespan: " << best.cost << "\n";
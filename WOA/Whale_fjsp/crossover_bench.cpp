@@ -0,0 +1,122 @@
+#include "include/modules.hpp"
+#include "whale.hpp"
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <functional>
+
+using namespace std;
+using namespace std::chrono;
+
+// Crossover Microbenchmark
+// 對 n = 1k ~ 100k、每個 task 最多 3 個前驅的隨機 DAG，量測 IPOX / TOPO_MERGE / ROX / MPX / TPX
+// 每次呼叫的時間 (child 緩衝重複使用；Crossover_Lib 每次執行只 Bind 一次，不隨交配次數付 O(T + E))，
+// 並與舊版 (std::find、每次回傳新 vector) 的 IPOX / ROX 比較；
+// 相同 rng 狀態下新舊版本必須產生相同的 child (分佈不變)
+//   g++ -O2 -std=c++17 crossover_bench.cpp -o crossover_bench
+
+
+// ----- Legacy Operators (O(n²)，僅供比較) ------
+Vec Legacy_IPOX(const Vec &parentA, const Vec &parentB) {
+    int n = parentA.size();
+    std::uniform_int_distribution<int> dist(1, n - 1);
+    int cut = dist(rng);
+    Vec child(parentA.begin(), parentA.begin() + cut);
+    for (int x : parentB) {
+        if (std::find(parentA.begin(), parentA.begin() + cut, x) == parentA.begin() + cut)
+            child.push_back(x);
+    }
+    return child;
+}
+
+Vec Legacy_ROX(const Vec &parentA, const Vec & /*parentB*/) {
+    int n = parentA.size();
+    Vec child;
+    std::uniform_int_distribution<int> dist(1, n - 1);
+    int k = dist(rng);
+    Vec pool = parentA;
+    std::shuffle(pool.begin(), pool.end(), rng);
+    child.insert(child.end(), pool.begin(), pool.begin() + k);
+    for (int x : parentA) {
+        if (std::find(child.begin(), child.end(), x) == child.end())
+            child.push_back(x);
+    }
+    return child;
+}
+
+
+// 平均每次呼叫的時間 (us)，至少跑 reps 次且至少 min_ms
+double Time_Per_Call(const function<void()>& op, int reps, double min_ms = 0.0) {
+    int calls = 0;
+    auto start = steady_clock::now();
+    double elapsed = 0.0;
+    while (calls < reps || elapsed < min_ms) {
+        op();
+        calls++;
+        elapsed = duration<double, std::milli>(steady_clock::now() - start).count();
+    }
+    return elapsed * 1000.0 / calls;
+}
+
+
+int main() {
+    const vector<int> sizes = {1000, 5000, 10000, 50000, 100000};
+    const int P = 4;
+    bool all_same = true;
+
+    printf("%8s %10s %10s %10s %10s %10s %14s %14s\n", "n", "IPOX", "TOPO", "ROX", "MPX", "TPX", "legacy IPOX", "legacy ROX");
+    for (int n : sizes) {
+        // 隨機 DAG：依隨機的拓撲序，每個 task 最多 3 條從前面 task 來的邊
+        Config cfg;
+        cfg.theTCount = n;
+        cfg.thePCount = P;
+
+        rng.seed(n);
+        Vec order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), rng);
+        for (int i = 1; i < n; ++i) {
+            int k = rng() % 4;
+            for (int e = 0; e < k; ++e) cfg.predMap[order[i]].push_back({order[rng() % i], 1.0});
+        }
+        Crossover_Lib::Bind(cfg);
+
+        Vec A(n), B(n), msA(n), msB(n);
+        std::iota(A.begin(), A.end(), 0);
+        B = A;
+        std::shuffle(A.begin(), A.end(), rng);
+        std::shuffle(B.begin(), B.end(), rng);
+        for (int t = 0; t < n; ++t) { msA[t] = rng() % P; msB[t] = rng() % P; }
+
+        // 分佈不變：相同 rng 狀態 -> 相同 child
+        Vec child;
+        for (int s = 0; s < 3; ++s) {
+            rng.seed(1000 + s);
+            Crossover_Lib::Crossover_SS(Crossover_Lib::SS_Crossover::IPOX, A, B, child, rng, cfg);
+            rng.seed(1000 + s);
+            all_same &= (child == Legacy_IPOX(A, B));
+            rng.seed(2000 + s);
+            Whale::ROX(A, B, child);
+            rng.seed(2000 + s);
+            all_same &= (child == Legacy_ROX(A, B));
+        }
+
+        Vec ss_child, ms_child;
+        int reps = std::max(20, 2000000 / n);
+        double t_ipox = Time_Per_Call([&]{ Crossover_Lib::Crossover_SS(Crossover_Lib::SS_Crossover::IPOX, A, B, ss_child, rng, cfg); }, reps);
+        double t_topo = Time_Per_Call([&]{ Crossover_Lib::Crossover_SS(Crossover_Lib::SS_Crossover::TOPO_MERGE, A, B, ss_child, rng, cfg); }, reps);
+        all_same &= Crossover_Lib::Is_Topological(ss_child, cfg);
+        double t_rox  = Time_Per_Call([&]{ Whale::ROX(A, B, ss_child); }, reps);
+        double t_mpx  = Time_Per_Call([&]{ Whale::MPX(msA, msB, ms_child); }, reps);
+        double t_tpx  = Time_Per_Call([&]{ Whale::TPX(msA, msB, ms_child); }, reps);
+        double t_lipox = Time_Per_Call([&]{ Vec c = Legacy_IPOX(A, B); }, 1);
+        double t_lrox  = Time_Per_Call([&]{ Vec c = Legacy_ROX(A, B); }, 1);
+
+        printf("%8d %8.1fus %8.1fus %8.1fus %8.1fus %8.1fus %12.1fus %12.1fus\n",
+               n, t_ipox, t_topo, t_rox, t_mpx, t_tpx, t_lipox, t_lrox);
+    }
+    cout << "\nSame offspring as legacy operators (TOPO_MERGE child topological): " << std::boolalpha << all_same << "\n";
+    return all_same ? 0 : 1;
+}
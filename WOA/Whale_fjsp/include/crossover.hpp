@@ -0,0 +1,294 @@
+#ifndef CROSSOVER_HPP
+#define CROSSOVER_HPP
+
+#include "config.hpp"
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+
+// Crossover Library (schedule string)
+// 所有算子都寫入呼叫端給的 child (會 resize 成 n，重複使用時不再配置)；A / B / child 可以是 std::vector<int>
+// 或 Population_Arena 的 Row (arena 中的一列，長度固定)，
+// 暫存空間放在每條執行緒自己的 Crossover_Workspace，不在每次交配時配置；
+// 引擎開始時要呼叫 Bind(config)，Config 在同一個位址被重新讀入 / 修改後也要再呼叫一次
+//
+//   OX / PMX        ：經典排列交配，成員以 bitset 判斷，不保證符合 DAG (交給 Solution_Function 修正)
+//   IPOX            ：保留 A 的前綴，其餘依 B 的順序補上；A、B 皆為拓撲序時 child 也是
+//   PPX             ：每個位置隨機決定取 A 或 B 中第一個尚未放入的任務；A、B 皆為拓撲序時 child 也是
+//   TOPO_MERGE      ：只從「前驅都已放入」的任務中挑，依隨機遮罩取在 A 或 B 中最前面者，
+//                     不論父代是否為拓撲序，child 一定是拓撲序
+namespace Crossover_Lib {
+
+enum class SS_Crossover { OX, PMX, IPOX, PPX, TOPO_MERGE };
+
+inline const char* SS_Crossover_Name(SS_Crossover op) {
+    switch (op) {
+        case SS_Crossover::OX:         return "OX";
+        case SS_Crossover::PMX:        return "PMX";
+        case SS_Crossover::IPOX:       return "IPOX";
+        case SS_Crossover::PPX:        return "PPX";
+        case SS_Crossover::TOPO_MERGE: return "TOPO_MERGE";
+        default:                       return "?";
+    }
+}
+
+
+// 固定大小的 task bitset
+class Task_Bitset {
+public:
+    void reset(int n) {
+        words_.assign((n + 63) / 64, 0ULL);
+    }
+    bool test(int i) const { return (words_[i >> 6] >> (i & 63)) & 1ULL; }
+    void set(int i)        { words_[i >> 6] |= (1ULL << (i & 63)); }
+
+private:
+    std::vector<uint64_t> words_;
+};
+
+
+// 綁定的 epoch：引擎開始時呼叫 Bind(config)，每次 Bind 都換一個新的 epoch，
+// 各執行緒的 workspace 在下一次使用時看到 epoch 變了才重新綁定 (每次交配只讀一次 atomic)
+inline std::atomic<uint64_t>& Bound_Epoch() {
+    static std::atomic<uint64_t> epoch(1);
+    return epoch;
+}
+
+
+// 每條執行緒的暫存空間：各算子的暫存陣列，與 DAG 的 CSR (只有 TOPO_MERGE / Is_Topological 需要，用到才建)
+struct Crossover_Workspace {
+    uint64_t epoch = 0;
+    const Config* config = nullptr;
+    int n = -1;
+    bool has_dag = false;
+    std::vector<int> pred_count;     // 每個 task 的前驅數
+    std::vector<int> succ_offset;    // CSR：task t 的後繼在 succs[succ_offset[t] .. succ_offset[t+1])
+    std::vector<int> succs;
+
+    Task_Bitset placed;
+    std::vector<int> posA, posB;     // task -> 在父代中的位置
+    std::vector<int> indeg;
+    std::vector<int> heapA, heapB;   // TOPO_MERGE 的 ready 集合 (依 posA / posB 排序)
+
+    // epoch、Config 位址或 task 數不同時重新綁定：只調整暫存陣列大小，CSR 留到 dag() 才建
+    void bind(const Config& cfg, uint64_t e) {
+        if (epoch == e && config == &cfg && n == (int)cfg.theTCount) return;
+        epoch = e;
+        config = &cfg;
+        n = cfg.theTCount;
+        has_dag = false;
+        posA.assign(n, 0);
+        posB.assign(n, 0);
+    }
+
+    // DAG 的 CSR，O(T + E)，同一次綁定只建一次
+    void dag() {
+        if (has_dag) return;
+        has_dag = true;
+        pred_count.assign(n, 0);
+        succ_offset.assign(n + 1, 0);
+        for (const auto& kv : config->predMap) {
+            pred_count[kv.first] = kv.second.size();
+            for (const auto& pr : kv.second) succ_offset[pr.first + 1]++;
+        }
+        for (int t = 0; t < n; ++t) succ_offset[t + 1] += succ_offset[t];
+        succs.assign(succ_offset[n], 0);
+        std::vector<int> fill(succ_offset.begin(), succ_offset.end() - 1);
+        for (const auto& kv : config->predMap)
+            for (const auto& pr : kv.second) succs[fill[pr.first]++] = kv.first;
+        indeg.assign(n, 0);
+        heapA.reserve(n);
+        heapB.reserve(n);
+    }
+};
+
+inline Crossover_Workspace& Workspace(const Config& config) {
+    thread_local Crossover_Workspace ws;
+    ws.bind(config, Bound_Epoch().load(std::memory_order_acquire));
+    return ws;
+}
+
+// 每次引擎執行開始時 (或 Config 在同一個位址被重新讀入 / 原地修改後) 呼叫一次；
+// 其他執行緒的 workspace 在下一次交配時重新綁定
+inline void Bind(const Config& config) {
+    Bound_Epoch().fetch_add(1, std::memory_order_acq_rel);
+    Workspace(config);
+}
+
+
+
+
+// OX：A 的 [c1, c2] 片段保留原位，其餘依 B 從 c2+1 開始的循環順序填入
+template <typename Seq, typename Out, typename Engine>
+void OX(const Seq& A, const Seq& B, Out& child, Engine& gen, Crossover_Workspace& ws) {
+    int n = A.size();
+    child.resize(n);
+    std::uniform_int_distribution<int> cutDist(0, n - 1);
+    int c1 = cutDist(gen), c2 = cutDist(gen);
+    if (c1 > c2) std::swap(c1, c2);
+
+    ws.placed.reset(n);
+    for (int i = c1; i <= c2; ++i) {
+        child[i] = A[i];
+        ws.placed.set(A[i]);
+    }
+    int idx = (c2 + 1) % n;
+    for (int k = 0; k < n; ++k) {
+        int gene = B[(c2 + 1 + k) % n];
+        if (!ws.placed.test(gene)) {
+            child[idx] = gene;
+            ws.placed.set(gene);
+            idx = (idx + 1) % n;
+        }
+    }
+}
+
+
+// PMX：A 的 [c1, c2] 片段保留原位，片段外取 B 的值，衝突時沿 A -> B 的對應找到不衝突的值
+template <typename Seq, typename Out, typename Engine>
+void PMX(const Seq& A, const Seq& B, Out& child, Engine& gen, Crossover_Workspace& ws) {
+    int n = A.size();
+    child.resize(n);
+    std::uniform_int_distribution<int> cutDist(0, n - 1);
+    int c1 = cutDist(gen), c2 = cutDist(gen);
+    if (c1 > c2) std::swap(c1, c2);
+
+    ws.placed.reset(n);
+    for (int i = 0; i < n; ++i) ws.posA[A[i]] = i;
+    for (int i = c1; i <= c2; ++i) {
+        child[i] = A[i];
+        ws.placed.set(A[i]);
+    }
+    for (int i = 0; i < n; ++i) {
+        if (i >= c1 && i <= c2) continue;
+        int v = B[i];
+        while (ws.placed.test(v)) v = B[ws.posA[v]];
+        child[i] = v;
+    }
+}
+
+
+// IPOX：A 的前 cut 個任務 + 其餘依 B 的順序
+template <typename Seq, typename Out, typename Engine>
+void IPOX(const Seq& A, const Seq& B, Out& child, Engine& gen, Crossover_Workspace& ws) {
+    int n = A.size();
+    child.resize(n);
+    if (n < 2) { std::copy(A.begin(), A.end(), child.begin()); return; }
+    std::uniform_int_distribution<int> dist(1, n - 1);
+    int cut = dist(gen);
+
+    ws.placed.reset(n);
+    for (int i = 0; i < cut; ++i) {
+        child[i] = A[i];
+        ws.placed.set(A[i]);
+    }
+    int idx = cut;
+    for (int x : B) {
+        if (!ws.placed.test(x)) child[idx++] = x;
+    }
+}
+
+
+// PPX：每個位置擲一次硬幣，從 A 或 B 取第一個尚未放入的任務
+template <typename Seq, typename Out, typename Engine>
+void PPX(const Seq& A, const Seq& B, Out& child, Engine& gen, Crossover_Workspace& ws) {
+    int n = A.size();
+    child.resize(n);
+    ws.placed.reset(n);
+    int ia = 0, ib = 0;
+    for (int k = 0; k < n; ++k) {
+        int x;
+        if (gen() & 1) {
+            while (ws.placed.test(A[ia])) ++ia;
+            x = A[ia];
+        } else {
+            while (ws.placed.test(B[ib])) ++ib;
+            x = B[ib];
+        }
+        child[k] = x;
+        ws.placed.set(x);
+    }
+}
+
+
+// TOPO_MERGE：Kahn 拓撲排序，ready 任務依在 A / B 中的位置排成兩個 min-heap，
+// 每一步擲硬幣決定從哪個 heap 取 (lazy deletion)，O((n + e) log n)
+template <typename Seq, typename Out, typename Engine>
+void TOPO_MERGE(const Seq& A, const Seq& B, Out& child, Engine& gen, Crossover_Workspace& ws) {
+    int n = A.size();
+    child.resize(n);
+    ws.placed.reset(n);
+    for (int i = 0; i < n; ++i) {
+        ws.posA[A[i]] = i;
+        ws.posB[B[i]] = i;
+    }
+    auto cmpA = [&ws](int a, int b){ return ws.posA[a] > ws.posA[b]; };
+    auto cmpB = [&ws](int a, int b){ return ws.posB[a] > ws.posB[b]; };
+    ws.heapA.clear();
+    ws.heapB.clear();
+    for (int t = 0; t < n; ++t) {
+        ws.indeg[t] = ws.pred_count[t];
+        if (ws.indeg[t] == 0) { ws.heapA.push_back(t); ws.heapB.push_back(t); }
+    }
+    std::make_heap(ws.heapA.begin(), ws.heapA.end(), cmpA);
+    std::make_heap(ws.heapB.begin(), ws.heapB.end(), cmpB);
+
+    for (int k = 0; k < n; ++k) {
+        bool fromA = gen() & 1;
+        std::vector<int>& heap = fromA ? ws.heapA : ws.heapB;
+        int x = -1;
+        while (!heap.empty()) {
+            if (fromA) std::pop_heap(heap.begin(), heap.end(), cmpA);
+            else       std::pop_heap(heap.begin(), heap.end(), cmpB);
+            int t = heap.back();
+            heap.pop_back();
+            if (!ws.placed.test(t)) { x = t; break; }
+        }
+        child[k] = x;
+        ws.placed.set(x);
+        for (int e = ws.succ_offset[x]; e < ws.succ_offset[x + 1]; ++e) {
+            int s = ws.succs[e];
+            if (--ws.indeg[s] == 0) {
+                ws.heapA.push_back(s); std::push_heap(ws.heapA.begin(), ws.heapA.end(), cmpA);
+                ws.heapB.push_back(s); std::push_heap(ws.heapB.begin(), ws.heapB.end(), cmpB);
+            }
+        }
+    }
+}
+
+
+
+
+// 依 op 呼叫對應的算子 (child 不可與 A / B 為同一個 vector)
+template <typename Seq, typename Out, typename Engine>
+void Crossover_SS(SS_Crossover op, const Seq& A, const Seq& B,
+                  Out& child, Engine& gen, const Config& config) {
+    Crossover_Workspace& ws = Workspace(config);
+    switch (op) {
+        case SS_Crossover::OX:         OX(A, B, child, gen, ws);         break;
+        case SS_Crossover::PMX:        PMX(A, B, child, gen, ws);        break;
+        case SS_Crossover::IPOX:       IPOX(A, B, child, gen, ws);       break;
+        case SS_Crossover::PPX:        PPX(A, B, child, gen, ws);        break;
+        case SS_Crossover::TOPO_MERGE: ws.dag(); TOPO_MERGE(A, B, child, gen, ws); break;
+    }
+}
+
+
+// ss 是否為 DAG 的拓撲序 (測試 / 除錯用)
+template <typename Seq>
+bool Is_Topological(const Seq& ss, const Config& config) {
+    Crossover_Workspace& ws = Workspace(config);
+    ws.dag();
+    int n = ss.size();
+    for (int i = 0; i < n; ++i) ws.posA[ss[i]] = i;
+    for (int t = 0; t < n; ++t)
+        for (int e = ws.succ_offset[t]; e < ws.succ_offset[t + 1]; ++e)
+            if (ws.posA[t] > ws.posA[ws.succs[e]]) return false;
+    return true;
+}
+
+} // namespace Crossover_Lib
+
+#endif
@@ -2,6 +2,7 @@
 #define WHALE_HPP
 
 #include "include/modules.hpp"
+#include "include/crossover.hpp"
 #include <algorithm>
 #include <random>
 #include <numeric>
@@ -14,102 +15,100 @@ class Whale : public Solution {
 private:
     const Config* cfg_;
 
-    // --- Crossover / mutation operators ---
-    // Improved Precedence Preserving Order-based Crossover (IPOX)
-    static Vec IPOX(const Vec &parentA, const Vec &parentB) {
-        int n = parentA.size();
-        Vec child(n, -1);
-        std::uniform_int_distribution<int> dist(1, n - 1);
-        int cut = dist(rng);
-        // 保留 parentA 前 cut 個元素
-        for (int i = 0; i < cut; ++i) child[i] = parentA[i];    
-        // 按 parentB 順序填入其餘元素
-        int idx = cut;
-        for (int x : parentB) {
-            if (std::find(child.begin(), child.begin() + cut, x) == child.begin() + cut) {
-                child[idx++] = x;
-            }
-        }
-        return child;
+    // Improved Precedence Preserving Order-based Crossover (IPOX)：使用 Crossover_Lib::IPOX
+    // (保留 parentA 前 cut 個元素，按 parentB 順序填入其餘元素，直接寫入 offspring.ss)
+    void IPOX(const Vec &parentA, const Vec &parentB, Vec &child) const {
+        Crossover_Lib::Crossover_SS(Crossover_Lib::SS_Crossover::IPOX, parentA, parentB, child, rng, *cfg_);
     }
 
+public:
+    // --- Crossover / mutation operators ---
+    // 都寫入呼叫端給的 child (resize 成 n，重複使用時不再配置)，O(n)；
+    // child 不可與 parentA / parentB 為同一個 vector
+
     // Multi-Point Crossover for machine assignment (MPX)
-    static Vec MPX(const Vec &parentA, const Vec &parentB) {
+    static void MPX(const Vec &parentA, const Vec &parentB, Vec &child) {
         int n = parentA.size();
-        Vec child(n);
+        child.resize(n);
         std::uniform_int_distribution<int> bit(0, 1);
         for (int i = 0; i < n; ++i) {
             child[i] = bit(rng) ? parentA[i] : parentB[i];
         }
-        return child;
     }
 
     // Random Order-based Crossover (ROX)
-    static Vec ROX(const Vec &parentA, const Vec &parentB) {
+    // 隨機選 k 個任務 (依洗牌後順序) 放到前端，其餘依 parentA 原順序補上；
+    // 洗牌直接在 child 上做，已放入的任務以 bitset 判斷 (取代對 child 的 std::find)
+    static void ROX(const Vec &parentA, const Vec &parentB, Vec &child) {
+        (void)parentB;
         int n = parentA.size();
-        Vec child;
+        if (n < 2) { child = parentA; return; }
         std::uniform_int_distribution<int> dist(1, n - 1);
         int k = dist(rng);
-        // 隨機選 k 個任務到前端
-        Vec pool = parentA;
-        std::shuffle(pool.begin(), pool.end(), rng);
-        child.insert(child.end(), pool.begin(), pool.begin() + k);
-        // 按原序加入剩餘任務
+        child.assign(parentA.begin(), parentA.end());
+        std::shuffle(child.begin(), child.end(), rng);
+
+        thread_local Crossover_Lib::Task_Bitset placed;
+        placed.reset(n);
+        for (int i = 0; i < k; ++i) placed.set(child[i]);
+        int idx = k;
         for (int x : parentA) {
-            if (std::find(child.begin(), child.end(), x) == child.end())
-                child.push_back(x);
+            if (!placed.test(x)) child[idx++] = x;
         }
-        return child;
     }
 
     // Two-Point Crossover for machine assignment (TPX)
-    static Vec TPX(const Vec &parentA, const Vec &parentB) {
+    static void TPX(const Vec &parentA, const Vec &parentB, Vec &child) {
         int n = parentA.size();
-        Vec child = parentA;
+        child.assign(parentA.begin(), parentA.end());
+        if (n < 2) return;
         std::uniform_int_distribution<int> dist(1, n - 1);
         int i = dist(rng), j = dist(rng);
         if (i > j) std::swap(i, j);
-        for (int k = i; k < j; ++k) {
-            child[k] = parentB[k];
-        }
-        return child;
+        std::copy(parentB.begin() + i, parentB.begin() + j, child.begin() + i);
     }
 
-public:
     // 建構子：初始化並計算成本
-    explicit Whale(const Config& cfg )
+    explicit Whale(const Config& cfg, bool useHeuristic = false)
         : cfg_(&cfg)
     {
-        Solution sol = GenerateInitialSolution( cfg );
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         // 計算初始解成本
         ScheduleResult res = Solution_Function(*this, cfg);
-        //cost = res.makespan;
+        cost = res.makespan;
     }
 
     // 更新函數：根據 a, p, best, randWhale 三種行為產生新 Whale
-    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
-        Whale offspring(*cfg_);
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &randWhale, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
         // 選擇行為
         if (p < 0.5) {
             if (std::abs(a) < 1.0) {
                 // Encircling Prey
-                offspring.ss = IPOX(best.ss, ss);
-                offspring.ms = MPX(best.ms, ms);
+                IPOX(best.ss, ss, offspring.ss);
+                MPX(best.ms, ms, offspring.ms);
             } else {
                 // Search for Prey
-                offspring.ss = IPOX(randWhale.ss, ss);
-                offspring.ms = MPX(randWhale.ms, ms);
+                IPOX(randWhale.ss, ss, offspring.ss);
+                MPX(randWhale.ms, ms, offspring.ms);
             }
         } else {
             // Spiral Updating
-            offspring.ss = ROX(best.ss, ss);
-            offspring.ms = TPX(best.ms, ms);
+            ROX(best.ss, ss, offspring.ss);
+            TPX(best.ms, ms, offspring.ms);
         }
         // 評估 offspring 成本
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
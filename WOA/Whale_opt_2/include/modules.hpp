@@ -5,6 +5,7 @@
 #include "config.hpp"
 #include "evaluation.hpp"
 #include "utils.hpp"
+#include "heft.hpp"
 
 
 #include <numeric>
@@ -23,24 +24,22 @@ Solution GenerateInitialSolution(const Config& cfg, bool useHeuristic=false){
     Solution sol;
 
 
+    if (useHeuristic) {
+        // HEFT (見 heft.hpp)
+        return HEFT_Solution(cfg);
+    }
+
+
     // Process Initial Schedule String
     sol.ss.resize(T);
     std::iota(sol.ss.begin(), sol.ss.end(), 0);
-    if (!useHeuristic) {
-        std::shuffle(sol.ss.begin(), sol.ss.end(), rng); 
-    }else{
-        // implement Herustic Solution
-    }
+    std::shuffle(sol.ss.begin(), sol.ss.end(), rng);
 
 
     // Process Initial Matching String
     sol.ms.resize(T);
     for (int t = 0; t < T; ++t) {
-        if (!useHeuristic) {
-            sol.ms[t] = rng() % P;
-        } else{
-            break; // implement Herustic Solution
-        }
+        sol.ms[t] = rng() % P;
     }
 
     return sol;
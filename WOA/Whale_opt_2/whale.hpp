@@ -15,14 +15,17 @@ private:
 
     // --- Discrete operators for ss 排序 ---
     // 1. Encircle (圍捕): SwapTowardBest — bring ss closer to best solution
+    //    先建 best 的反排列 (task -> 位置)，每次比較 O(1)，整體 O(n) 而不是 O(n²)
     static void swapTowardBestSS(Vec &ss, const Vec &best, double A) {
         int n = ss.size();
+        thread_local Vec posBest;
+        posBest.resize(n);
+        for (int k = 0; k < n; ++k) posBest[best[k]] = k;
         int m = std::ceil(std::abs(A) * n / 2.0);
         std::uniform_int_distribution<int> dist(0, n - 1);
         while (m-- > 0) {
             int i = dist(rng), j = dist(rng);
-            auto pos_i = std::find(best.begin(), best.end(), ss[i]) - best.begin();
-            auto pos_j = std::find(best.begin(), best.end(), ss[j]) - best.begin();
+            int pos_i = posBest[ss[i]], pos_j = posBest[ss[j]];
             if ((i < j && pos_i > pos_j) || (i > j && pos_i < pos_j)) {
                 std::swap(ss[i], ss[j]);
             }
@@ -40,15 +43,17 @@ private:
     }
 
     // 3. Exploration (搜索): BlockShuffle — cut and insert
+    //    片段 [i, j] 移到剩餘序列的第 q 個位置，以 rotate 原地完成 (不配置、不 erase / insert)
     static void blockShuffleSS(Vec &ss) {
         int n = ss.size(); if (n < 2) return;
         std::uniform_int_distribution<int> dist(0, n - 1);
         int i = dist(rng), j = dist(rng);
         if (i > j) std::swap(i, j);
-        Vec segment(ss.begin() + i, ss.begin() + j + 1);
-        ss.erase(ss.begin() + i, ss.begin() + j + 1);
-        std::uniform_int_distribution<int> distPos(0, ss.size());
-        ss.insert(ss.begin() + distPos(rng), segment.begin(), segment.end());
+        int len = j - i + 1;
+        std::uniform_int_distribution<int> distPos(0, n - len);
+        int q = distPos(rng);
+        if (q <= i) std::rotate(ss.begin() + q, ss.begin() + i, ss.begin() + j + 1);
+        else        std::rotate(ss.begin() + i, ss.begin() + j + 1, ss.begin() + j + 1 + (q - i));
     }
 
     // --- Discrete operators for ms 匹配 ---
@@ -80,16 +85,18 @@ private:
     }
 
 public:
-    explicit Whale(const Config& cfg) : cfg_(&cfg) {
-        Solution sol = GenerateInitialSolution(cfg);
+    explicit Whale(const Config& cfg, bool useHeuristic = false) : cfg_(&cfg) {
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         ScheduleResult res = Solution_Function(*this, cfg);
         cost = res.makespan;
     }
 
-    Whale update(const Whale &best, const Whale &/*randWhale*/, double a, double p) const {
-        Whale offspring(*cfg_);
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &/*randWhale*/, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
         offspring.ss = ss;
         offspring.ms = ms;
 
@@ -115,6 +122,11 @@ public:
 
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
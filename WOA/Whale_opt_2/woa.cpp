@@ -1,4 +1,5 @@
 #include "include/modules.hpp"
+#include "include/budget.hpp"
 #include "whale.hpp"
 #include <iostream>
 #include <vector>
@@ -13,15 +14,21 @@ using namespace std::chrono;
 
 // Avg Cost = 488.900000 , 20 , 100
 // Avg Cost =  444.700000 , 20 , 200
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// use_Heuristic：第一隻鯨魚用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 Solution Whale_Optimize(const Config& cfg,
                         int num_whales = 20,
-                        int max_iter   = 200) 
+                        int max_iter   = 200,
+                        Search_Budget* budget = nullptr,
+                        bool use_Heuristic = false) 
 {
+    if (budget) budget->start();
+
     // 1. 初始化種群
     std::vector<Whale> pop;
     pop.reserve(num_whales);
     for (int i = 0; i < num_whales; ++i) {
-        pop.emplace_back(cfg);
+        pop.emplace_back(cfg, use_Heuristic && i == 0);
     }
 
     // 2. 找到初始最優
@@ -29,6 +36,11 @@ Solution Whale_Optimize(const Config& cfg,
     for (auto& w : pop) {
         if (w.cost < best.cost) best = w;
     }
+    Whale offspring = pop[0];   // 重複使用的 offspring 緩衝 (複製建構，不做隨機初始化與評估)
+    if (budget && budget->spend(best.cost, num_whales)) {
+        budget->finish();
+        return static_cast<Solution>(best);
+    }
 
     // 3. 迭代演化
     for (int iter = 1; iter <= max_iter; ++iter) {
@@ -47,12 +59,15 @@ Solution Whale_Optimize(const Config& cfg,
             // 隨機機率 p ∈ [0,1]
             double p = std::generate_canonical<double, 10>(rng);
 
-            // 更新
-            Whale offspring = cur.update(best, randWhale, a, p);
-            // 若後代更優，替換當前
+            // 更新：寫入重複使用的 offspring 緩衝
+            cur.update_into(best, randWhale, a, p, offspring);
+            // 若後代更優，替換當前 (交換緩衝，舊的 current 成為下一次的 offspring 緩衝)
             if (offspring.cost < cur.cost) {
-                pop[i] = std::move(offspring);
+                std::swap(cur, offspring);
             }
+
+            // 中斷後下方仍會更新全局最優
+            if (budget && budget->spend(std::min(best.cost, cur.cost))) break;
         }
 
         // 更新全局最優
@@ -62,9 +77,12 @@ Solution Whale_Optimize(const Config& cfg,
 
         
         // std::cout << "Iter " << iter << ", best makespan = " << best.cost << "\n";
+
+        if (budget && budget->stopped()) break;
     }
 
    
+    if (budget) budget->finish();
     return static_cast<Solution>(best);
 }
 
@@ -5,6 +5,7 @@
 #include "config.hpp"
 #include "evaluation.hpp"
 #include "utils.hpp"
+#include "heft.hpp"
 
 
 #include <numeric>
@@ -17,34 +18,39 @@ std::mt19937 rng(std::random_device{}());
 
 
 
-Solution GenerateInitialSolution(const Config& cfg, bool useHeuristic=false){
+// gen：亂數來源 (平行版本每隻鯨魚各自的 stream)
+template <typename Engine>
+Solution GenerateInitialSolution(const Config& cfg, bool useHeuristic, Engine& gen){
     int T = cfg.theTCount;
     int P = cfg.thePCount;
     Solution sol;
 
 
+    if (useHeuristic) {
+        // HEFT (見 heft.hpp)
+        return HEFT_Solution(cfg);
+    }
+
+
     // Process Initial Schedule String
     sol.ss.resize(T);
     std::iota(sol.ss.begin(), sol.ss.end(), 0);
-    if (!useHeuristic) {
-        std::shuffle(sol.ss.begin(), sol.ss.end(), rng); 
-    }else{
-        // implement Herustic Solution
-    }
+    std::shuffle(sol.ss.begin(), sol.ss.end(), gen);
 
 
     // Process Initial Matching String
     sol.ms.resize(T);
     for (int t = 0; t < T; ++t) {
-        if (!useHeuristic) {
-            sol.ms[t] = rng() % P;
-        } else{
-            break; // implement Herustic Solution
-        }
+        sol.ms[t] = gen() % P;
     }
 
     return sol;
 }
 
 
+Solution GenerateInitialSolution(const Config& cfg, bool useHeuristic=false){
+    return GenerateInitialSolution(cfg, useHeuristic, rng);
+}
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef RNG_STREAM_HPP
+#define RNG_STREAM_HPP
+
+#include <cstdint>
+#include <limits>
+
+// Counter-Based RNG Stream
+// 第 k 個輸出只由 (key, k) 決定：mix(key + (k + 1) * γ) (SplitMix64 的 finalizer)，沒有內部狀態鏈；
+// key 由 (seed, iteration, agent) 雜湊而得，所以同一個 (seed, iteration, agent) 不論在哪條執行緒、
+// 以什麼順序執行，拿到的亂數序列都一樣 —— 平行結果與執行緒數無關
+// 滿足 UniformRandomBitGenerator，可直接給 std::shuffle / std::*_distribution 使用
+
+inline uint64_t Mix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// (seed, iteration, agent) -> stream key
+inline uint64_t Stream_Key(uint64_t seed, uint64_t iteration, uint64_t agent) {
+    uint64_t h = Mix64(seed + 0x9E3779B97F4A7C15ULL);
+    h = Mix64(h ^ (iteration + 0x632BE59BD9B4E019ULL));
+    return Mix64(h ^ (agent + 0xD1B54A32D192ED03ULL));
+}
+
+class Counter_RNG {
+public:
+    typedef uint64_t result_type;
+
+    explicit Counter_RNG(uint64_t key = 0) : key_(key), counter_(0) {}
+    Counter_RNG(uint64_t seed, uint64_t iteration, uint64_t agent)
+        : key_(Stream_Key(seed, iteration, agent)), counter_(0) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return Mix64(key_ + (++counter_) * 0x9E3779B97F4A7C15ULL); }
+
+    uint64_t counter() const { return counter_; }
+
+private:
+    uint64_t key_;
+    uint64_t counter_;
+};
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef PARALLEL_WOA_HPP
+#define PARALLEL_WOA_HPP
+
+#include "include/modules.hpp"
+#include "include/budget.hpp"
+#include "include/population_arena.hpp"
+#include "include/thread_pool.hpp"
+#include "include/rng_stream.hpp"
+#include "whale.hpp"
+
+#include <vector>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+
+// Synchronous Parallel WOA
+// 每次迭代所有鯨魚讀同一份凍結的快照 (族群 arena + leader)，後代寫入另一個 arena 的同一個 slot，
+// 迭代結束時兩個 arena 互換 (雙緩衝)；鯨魚之間沒有共享寫入，更新與評估可以整批丟給 thread pool。
+// 每隻鯨魚在每次迭代使用自己的 Counter_RNG(seed, iter, i)，leader 在主執行緒依 index 順序取出，
+// 所以同一個 seed 的結果與執行緒數、排程順序都無關 (num_threads = 1 與 N 結果相同)
+//
+// 與 Whale_Optimize (非同步，依序更新、立即看到新的 leader) 的差別：
+//   - 同一次迭代中後面的鯨魚看不到前面鯨魚的改善 (同步更新)
+//   - 不做 diversity 的複製品拒絕 / 移民 (那是依序遞增更新的結構)
+
+
+// ----- Parallel WOA Parameters ------
+struct Parallel_WOA_Params {
+    int num_whales;
+    int max_iter;
+    unsigned int num_threads;      // 0 = hardware_concurrency
+    uint64_t seed;                 // 所有鯨魚的亂數 stream 由此衍生
+    bool use_Heuristic;            // true：鯨魚 0 用 HEFT 解 (見 include/heft.hpp)，其餘隨機
+
+    Parallel_WOA_Params(){
+        num_whales  = 20;
+        max_iter    = 200;
+        num_threads = 0;
+        seed        = std::random_device{}();
+        use_Heuristic = false;
+    }
+};
+
+
+// 把 [0, n) 切成 pool->size() 段並行執行 body(i)，pool 為 nullptr 或只有一條執行緒時逐一執行
+template <typename Body>
+inline void Parallel_For(int n, Work_Stealing_Pool* pool, const Body& body) {
+    if (!pool || pool->size() <= 1 || n < 2) {
+        for (int i = 0; i < n; ++i) body(i);
+        return;
+    }
+    int chunks = std::min<int>(pool->size(), n);
+    for (int c = 0; c < chunks; ++c) {
+        int lo = (long long)n * c / chunks, hi = (long long)n * (c + 1) / chunks;
+        pool->submit([&body, lo, hi]{
+            for (int i = lo; i < hi; ++i) body(i);
+        });
+    }
+    pool->wait_idle();
+}
+
+
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// (評估次數上限在迭代邊界檢查：最後一次迭代只更新前 remaining 隻鯨魚，不會超出)
+Solution Parallel_Whale_Optimize(const Config& cfg,
+                                 const Parallel_WOA_Params& params = Parallel_WOA_Params(),
+                                 vector<double>* GB_Recorder = nullptr, vector<double>* PB_Recorder = nullptr,
+                                 Search_Budget* budget = nullptr)
+{
+    if (budget) budget->start();
+
+    int N = std::max(1, params.num_whales);
+    int T = cfg.theTCount;
+    int P = cfg.thePCount;
+    Work_Stealing_Pool pool(params.num_threads);
+
+    // 1. 初始化種群 (iteration 0 的 stream)
+    Population_Arena pop(N, T);
+    Population_Arena next(N, T);
+    Parallel_For(N, &pool, [&](int i) {
+        Counter_RNG gen(params.seed, 0, i);
+        Solution sol = GenerateInitialSolution(cfg, params.use_Heuristic && i == 0, gen);
+        sol.cost = Solution_Function(sol, cfg).makespan;
+        pop.load(i, sol);
+    });
+
+    // 2. 找到初始最優 (index 最小者優先)
+    Solution best;
+    pop.store(pop.best_index(), best);
+    if (budget && budget->spend(best.cost, N)) {
+        budget->finish();
+        return best;
+    }
+
+    // 3. 迭代演化
+    for (int iter = 1; iter <= params.max_iter; ++iter) {
+        double a = 2.0 * (1.0 - double(iter) / params.max_iter);
+
+        // 評估次數上限：最後一次迭代只更新前 active 隻，其餘原樣保留
+        int active = N;
+        if (budget && budget->max_evals > 0)
+            active = (int)std::max(0LL, std::min<long long>(N, budget->max_evals - budget->evals));
+
+        // 快照 (pop, best) 在這個區塊內只讀；鯨魚 i 只寫 next 的 slot i
+        Parallel_For(N, &pool, [&](int i) {
+            if (i >= active) { next.copy_member(i, pop, i); return; }
+            Counter_RNG gen(params.seed, iter, i);
+
+            int rand_idx = i;
+            if (N > 1) {
+                do { rand_idx = gen() % N; }
+                while (rand_idx == i);
+            }
+            double p = std::generate_canonical<double, 10>(gen);
+
+            Member_View child = next.view(i);
+            child.ss.copy_from(pop.ss(i));
+            child.ms.copy_from(pop.ms(i));
+            Whale::Apply_Behavior(child.ss, child.ms, best.ss, best.ms, pop.ss(rand_idx), pop.ms(rand_idx), a, p, P, gen);
+            double offspring_cost = Evaluate_Member(child, cfg);
+
+            // 後代沒有比較好：保留 current
+            if (!(offspring_cost < pop.cost(i))) next.copy_member(i, pop, i);
+        });
+        pop.swap(next);
+
+        // 更新全局最優 (主執行緒，依 index 順序)
+        int b = pop.best_index();
+        if (pop.cost(b) < best.cost) pop.store(b, best);
+
+        if (GB_Recorder) GB_Recorder->push_back(best.cost);
+        if (PB_Recorder) PB_Recorder->push_back(pop.avg_cost());
+
+        if (budget) {
+            bool stop = false;
+            for (int k = 0; k < active; ++k) stop = budget->spend(best.cost);
+            if (stop || active < N) break;
+        }
+    }
+
+    if (budget) budget->finish();
+    return best;
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define WHALE_HPP
 
 #include "include/modules.hpp"
+#include "include/population_arena.hpp"
 #include <algorithm>
 #include <random>
 #include <numeric>
@@ -13,16 +14,22 @@ class Whale : public Solution {
 private:
     const Config* cfg_;
 
+    // 以下算子都是樣板：Vec 或 arena 的 Row 都可以直接使用
+
     // --- Discrete operators for ss 排序 ---
     // 1. Encircle (圍捕): SwapTowardBest — bring ss closer to best solution
-    static void swapTowardBestSS(Vec &ss, const Vec &best, double A) {
+    //    先建 best 的反排列 (task -> 位置)，每次比較 O(1)，整體 O(n) 而不是 O(n²)
+    template <class SS, class Best, class Engine>
+    static void swapTowardBestSS(SS &ss, const Best &best, double A, Engine &gen) {
         int n = ss.size();
+        thread_local Vec posBest;
+        posBest.resize(n);
+        for (int k = 0; k < n; ++k) posBest[best[k]] = k;
         int m = std::ceil(std::abs(A) * n / 2.0);
         std::uniform_int_distribution<int> dist(0, n - 1);
         while (m-- > 0) {
-            int i = dist(rng), j = dist(rng);
-            auto pos_i = std::find(best.begin(), best.end(), ss[i]) - best.begin();
-            auto pos_j = std::find(best.begin(), best.end(), ss[j]) - best.begin();
+            int i = dist(gen), j = dist(gen);
+            int pos_i = posBest[ss[i]], pos_j = posBest[ss[j]];
             if ((i < j && pos_i > pos_j) || (i > j && pos_i < pos_j)) {
                 std::swap(ss[i], ss[j]);
             }
@@ -30,98 +37,125 @@ private:
     }
 
     // 2. Spiral (螺旋): TwoOptReverse — local reversal (2-Opt)
-    static void twoOptReverseSS(Vec &ss) {
+    template <class SS, class Engine>
+    static void twoOptReverseSS(SS &ss, Engine &gen) {
         int n = ss.size(); if (n < 2) return;
         std::uniform_int_distribution<int> dist(0, n - 2);
-        int i = dist(rng);
+        int i = dist(gen);
         std::uniform_int_distribution<int> dist2(i + 1, n - 1);
-        int j = dist2(rng);
+        int j = dist2(gen);
         std::reverse(ss.begin() + i, ss.begin() + j + 1);
     }
 
     // 3. Exploration (搜索): BlockShuffle — cut and insert
-    static void blockShuffleSS(Vec &ss) {
+    //    片段 [i, j] 移到剩餘序列的第 q 個位置，以 rotate 原地完成 (長度不變，Row 也適用)
+    template <class SS, class Engine>
+    static void blockShuffleSS(SS &ss, Engine &gen) {
         int n = ss.size(); if (n < 2) return;
         std::uniform_int_distribution<int> dist(0, n - 1);
-        int i = dist(rng), j = dist(rng);
+        int i = dist(gen), j = dist(gen);
         if (i > j) std::swap(i, j);
-        Vec segment(ss.begin() + i, ss.begin() + j + 1);
-        ss.erase(ss.begin() + i, ss.begin() + j + 1);
-        std::uniform_int_distribution<int> distPos(0, ss.size());
-        ss.insert(ss.begin() + distPos(rng), segment.begin(), segment.end());
+        int len = j - i + 1;
+        std::uniform_int_distribution<int> distPos(0, n - len);
+        int q = distPos(gen);
+        if (q <= i) std::rotate(ss.begin() + q, ss.begin() + i, ss.begin() + j + 1);
+        else        std::rotate(ss.begin() + i, ss.begin() + j + 1, ss.begin() + j + 1 + (q - i));
     }
 
     // --- Discrete operators for ms 匹配 ---
     // 1. Encircle (圍捕): GreedyAdopt — adopt best processor with probability |A|
-    static void greedyAdoptMS(Vec &ms, const Vec &best, double A, int P) {
+    template <class MS, class Best, class Engine>
+    static void greedyAdoptMS(MS &ms, const Best &best, double A, int P, Engine &gen) {
         int n = ms.size();
         std::uniform_real_distribution<double> prob(0.0, 1.0);
         std::uniform_int_distribution<int> distP(0, P - 1);
         for (int k = 0; k < n; ++k) {
-            if (prob(rng) < std::abs(A)) ms[k] = best[k];
-            else ms[k] = distP(rng);
+            if (prob(gen) < std::abs(A)) ms[k] = best[k];
+            else ms[k] = distP(gen);
         }
     }
 
     // 2. Spiral (螺旋): SingleSwap — swap two assignments
-    static void singleSwapMS(Vec &ms) {
+    template <class MS, class Engine>
+    static void singleSwapMS(MS &ms, Engine &gen) {
         int n = ms.size(); if (n < 2) return;
         std::uniform_int_distribution<int> dist(0, n - 1);
-        int i = dist(rng), j = dist(rng);
+        int i = dist(gen), j = dist(gen);
         std::swap(ms[i], ms[j]);
     }
 
     // 3. Exploration (搜索): RandomReset — reset k assignments
-    static void randomResetMS(Vec &ms, int P) {
+    template <class MS, class Engine>
+    static void randomResetMS(MS &ms, int P, Engine &gen) {
         int n = ms.size();
         int k = std::ceil(0.2 * n);
         std::uniform_int_distribution<int> distIdx(0, n - 1);
         std::uniform_int_distribution<int> distP(0, P - 1);
-        for (int t = 0; t < k; ++t) ms[distIdx(rng)] = distP(rng);
+        for (int t = 0; t < k; ++t) ms[distIdx(gen)] = distP(gen);
     }
 
 public:
-    explicit Whale(const Config& cfg) : cfg_(&cfg) {
-        Solution sol = GenerateInitialSolution(cfg);
+    explicit Whale(const Config& cfg, bool useHeuristic = false) : cfg_(&cfg) {
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         ScheduleResult res = Solution_Function(*this, cfg);
         cost = res.makespan;
     }
 
-    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
-        Whale offspring(*cfg_);
-        offspring.ss = ss;
-        offspring.ms = ms;
-
+    // 一次 WOA 行為：(ss, ms) 進來時是 current 的複本，依 a, p 原地改成 offspring (不評估)
+    // 所有亂數取自 gen (平行版本每隻鯨魚各自的 stream)；不給 gen 時使用全域 rng
+    template <class SS, class MS, class BestSS, class BestMS, class RandSS, class RandMS, class Engine>
+    static void Apply_Behavior(SS &ss, MS &ms, const BestSS &best_ss, const BestMS &best_ms,
+                               const RandSS &rand_ss, const RandMS &rand_ms, double a, double p, int P, Engine &gen) {
         // 隨機係數、A 計算
         std::uniform_real_distribution<double> distR(0.0,1.0);
-        double r = distR(rng);
+        double r = distR(gen);
         double A = 2 * a * r - a;
 
         if (p < 0.5) {
             if (std::abs(A) < 1.0) {
                 // Encircling prey (圍捕)：向 best 靠攏
-                swapTowardBestSS(offspring.ss, best.ss, A);
-                greedyAdoptMS(offspring.ms, best.ms, A, cfg_->thePCount);
+                swapTowardBestSS(ss, best_ss, A, gen);
+                greedyAdoptMS(ms, best_ms, A, P, gen);
             } else {
                 // Exploration (搜索)：向 randWhale 或做大跳躍
                 // 1) 接近 randWhale
-                offspring.ss = randWhale.ss;
-                offspring.ms = randWhale.ms;
+                std::copy(rand_ss.begin(), rand_ss.end(), ss.begin());
+                std::copy(rand_ms.begin(), rand_ms.end(), ms.begin());
                 // 2) 或大跳躍離散算子進一步擾動
-                blockShuffleSS(offspring.ss);
-                randomResetMS(offspring.ms, cfg_->thePCount);
+                blockShuffleSS(ss, gen);
+                randomResetMS(ms, P, gen);
             }
         } else {
             // Spiral updating position (螺旋)：局部精細調整
-            twoOptReverseSS(offspring.ss);
-            singleSwapMS(offspring.ms);
+            twoOptReverseSS(ss, gen);
+            singleSwapMS(ms, gen);
         }
+    }
+
+    template <class SS, class MS, class BestSS, class BestMS, class RandSS, class RandMS>
+    static void Apply_Behavior(SS &ss, MS &ms, const BestSS &best_ss, const BestMS &best_ms,
+                               const RandSS &rand_ss, const RandMS &rand_ms, double a, double p, int P) {
+        Apply_Behavior(ss, ms, best_ss, best_ms, rand_ss, rand_ms, a, p, P, rng);
+    }
+
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &randWhale, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
+        offspring.ss = ss;
+        offspring.ms = ms;
+
+        Apply_Behavior(offspring.ss, offspring.ms, best.ss, best.ms, randWhale.ss, randWhale.ms, a, p, cfg_->thePCount);
 
-        
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
@@ -1,5 +1,8 @@
 #include "include/modules.hpp"
 #include "whale.hpp"
+#include "include/budget.hpp"
+#include "include/diversity.hpp"
+#include "parallel_woa.hpp"
 #include <iostream>
 #include <vector>
 #include <chrono>
@@ -13,22 +16,46 @@ using namespace std::chrono;
 
 // Avg Cost = 488.900000 , 20 , 100
 // Avg Cost =  444.700000 , 20 , 200
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// diversity：與族群中鯨魚相同的後代不評估、不替換，多樣性過低時最差的一部分換成隨機新解；
+// DV_Recorder 紀錄每次迭代的族群多樣性 (0 ~ 1)；use_Heuristic：第一隻鯨魚用 HEFT 解 (見 include/heft.hpp)
 Solution Whale_Optimize(const Config& cfg,
                         int num_whales = 20,
                         int max_iter   = 200 ,
-                    vector<double>* GB_Recorder =nullptr , vector<double>* PB_Recorder=nullptr) 
+                    vector<double>* GB_Recorder =nullptr , vector<double>* PB_Recorder=nullptr ,
+                    Search_Budget* budget = nullptr,
+                    const Diversity_Params& diversity_params = Diversity_Params(),
+                    vector<double>* DV_Recorder = nullptr,
+                    bool use_Heuristic = false) 
 {
-    // 1. 初始化種群
-    std::vector<Whale> pop;
-    pop.reserve(num_whales);
+    if (budget) budget->start();
+
+    // 1. 初始化種群 (arena：所有 ss / ms / cost 各放在一塊連續記憶體)
+    int T = cfg.theTCount;
+    int P = cfg.thePCount;
+    Population_Arena pop(num_whales, T);
     for (int i = 0; i < num_whales; ++i) {
-        pop.emplace_back(cfg);
+        Solution sol = GenerateInitialSolution(cfg, use_Heuristic && i == 0);
+        ScheduleResult res = Solution_Function(sol, cfg);
+        sol.cost = res.makespan;
+        pop.load(i, sol);
     }
+    Population_Arena offspring(1, T);   // 重複使用的 offspring 緩衝，迭代中不再配置
+
+    // 族群的指紋與多樣性
+    bool dedup = diversity_params.reject_duplicates;
+    Population_Diversity diversity;
+    diversity.reset(T, P);
+    for (int i = 0; i < num_whales; ++i) diversity.add(pop.ss(i), pop.ms(i));
+    Immigration_Policy immigration(diversity_params);
+    if (DV_Recorder) DV_Recorder->push_back(diversity.diversity());
 
     // 2. 找到初始最優
-    Whale best = pop[0];
-    for (auto& w : pop) {
-        if (w.cost < best.cost) best = w;
+    Solution best;
+    pop.store(pop.best_index(), best);
+    if (budget && budget->spend(best.cost, num_whales)) {
+        budget->finish();
+        return best;
     }
 
     // 3. 迭代演化
@@ -42,34 +69,61 @@ Solution Whale_Optimize(const Config& cfg,
             do { rand_idx = rng() % num_whales; }
             while (rand_idx == i);
 
-            Whale& cur = pop[i];
-            Whale& randWhale = pop[rand_idx];
-
             // 隨機機率 p ∈ [0,1]
             double p = std::generate_canonical<double, 10>(rng);
 
-            // 更新
-            Whale offspring = cur.update(best, randWhale, a, p);
-            // 若後代更優，替換當前
-            if (offspring.cost < cur.cost) {
-                pop[i] = std::move(offspring);
+            // 更新：從 current 複製到 offspring 緩衝後原地套用算子，只評估一次
+            Member_View child = offspring.view(0);
+            child.ss.copy_from(pop.ss(i));
+            child.ms.copy_from(pop.ms(i));
+            Whale::Apply_Behavior(child.ss, child.ms, best.ss, best.ms, pop.ss(rand_idx), pop.ms(rand_idx), a, p, P);
+            if (dedup && diversity.contains(child.ss, child.ms)) continue;   // 複製品：不評估
+            double offspring_cost = Evaluate_Member(child, cfg);
+
+            // 若後代更優 (且修正後不是複製品)，替換當前
+            if (offspring_cost < pop.cost(i) && !(dedup && diversity.contains(child.ss, child.ms))) {
+                diversity.remove(pop.ss(i), pop.ms(i));
+                pop.copy_member(i, offspring, 0);
+                diversity.add(pop.ss(i), pop.ms(i));
             }
+
+            // 中斷後下方仍會更新全局最優
+            if (budget && budget->spend(std::min(best.cost, offspring_cost))) break;
         }
 
-        // 更新全局最優
-        double pAvg_cost = 0;
-        for (auto& w : pop) {
-            if (w.cost < best.cost) best = w;
-            pAvg_cost += w.cost;
+        // 多樣性過低：最差的一部分 (最優除外) 換成隨機新解
+        if (!(budget && budget->stopped()) && immigration.due(diversity.diversity(), iter)) {
+            int count = immigration.count(num_whales);
+            std::vector<int> order(num_whales);
+            std::iota(order.begin(), order.end(), 0);
+            std::partial_sort(order.begin(), order.begin() + count, order.end(),
+                [&pop](int x, int y){ return pop.cost(x) > pop.cost(y); });
+            for (int k = 0; k < count; ++k) {
+                int w = order[k];
+                Solution sol = GenerateInitialSolution(cfg);
+                sol.cost = Solution_Function(sol, cfg).makespan;
+                diversity.remove(pop.ss(w), pop.ms(w));
+                pop.load(w, sol);
+                diversity.add(pop.ss(w), pop.ms(w));
+            }
+            if (budget) budget->spend(best.cost, count);
         }
 
-        //GB_Recorder->push_back(best.cost);
-        //PB_Recorder->push_back(pAvg_cost/num_whales);
+        // 更新全局最優
+        int b = pop.best_index();
+        if (pop.cost(b) < best.cost) pop.store(b, best);
+        double pAvg_cost = pop.avg_cost();
+
+        if (GB_Recorder) GB_Recorder->push_back(best.cost);
+        if (PB_Recorder) PB_Recorder->push_back(pAvg_cost);
+        if (DV_Recorder) DV_Recorder->push_back(diversity.diversity());
         // std::cout << "Iter " << iter << ", best makespan = " << best.cost << "\n";
+
+        if (budget && budget->stopped()) break;
     }
 
-   
-    return static_cast<Solution>(best);
+    if (budget) budget->finish();
+    return best;
 }
 
 
@@ -89,10 +143,16 @@ int main() {
     double worst_cost = 0;
 
     //vector<double> GB_Recorder,PB_Recorder;
+
+    // 複製品拒絕與多樣性觸發的移民 (Diversity_Params 預設關閉)
+    Diversity_Params diversity_params;
+    diversity_params.reject_duplicates     = true;
+    diversity_params.immigration_threshold = 0.1;
     
     for(int i =0;i<num_loop;i++){
         auto start = std::chrono::high_resolution_clock::now();
-        Solution best = Whale_Optimize(cfg , Num_of_whale,200/*, &GB_Recorder,&PB_Recorder*/);
+        Solution best = Whale_Optimize(cfg , Num_of_whale, 200, nullptr, nullptr, nullptr, diversity_params);
+        // 同步平行版本：Parallel_WOA_Params p; p.num_whales = Num_of_whale; Solution best = Parallel_Whale_Optimize(cfg, p);
         auto end = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
         cout << "Time Usage : " << duration.count() << " ms" << std::endl;
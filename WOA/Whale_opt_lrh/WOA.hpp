@@ -5,6 +5,7 @@
 
 
 #include "include/modules.hpp"
+#include "include/budget.hpp"
 #include <algorithm>
 #include <random>
 #include <numeric>
@@ -35,10 +36,10 @@ private:
         ms[idx] = distP(rng);
     }
 
-    // Crossover: take prefix from parentA then fill rest by order from parentB
-    static Vec prefixCrossover(const Vec &parentA, const Vec &parentB) {
+    // Crossover: take prefix from parentA then fill rest by order from parentB (寫入 child，重複使用其記憶體)
+    static void prefixCrossover(const Vec &parentA, const Vec &parentB, Vec &child) {
         int n = parentA.size();
-        Vec child(n, -1);
+        child.resize(n);
         std::uniform_int_distribution<int> dist(1, n-1);
         int cut = dist(rng);
         // prefix
@@ -50,20 +51,22 @@ private:
                 child[idx++] = x;
             }
         }
-        return child;
     }
 
 public:
-    explicit Whale(const Config& cfg) : cfg_(&cfg)
+    explicit Whale(const Config& cfg, bool useHeuristic = false) : cfg_(&cfg)
     {
-        Solution sol = GenerateInitialSolution(cfg);
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         ScheduleResult res = Solution_Function(*this, cfg);
+        cost = res.makespan;
     }
 
-    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
-        Whale offspring(*cfg_);
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &randWhale, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
         // Exploration vs Exploitation
         if (p < 0.5) {
             // Exploration: small random mutations
@@ -73,7 +76,7 @@ public:
             mutateMS(offspring.ms, cfg_->thePCount);
         } else {
             // Exploitation: combine with best
-            offspring.ss = prefixCrossover(best.ss, ss);
+            prefixCrossover(best.ss, ss, offspring.ss);
             offspring.ms = ms;
             if (std::abs(a) < 1.0) {
                 // Encircle best: one mutation on ms
@@ -86,21 +89,32 @@ public:
         }
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
 
 
 
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// use_Heuristic：第一隻鯨魚用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 Solution Whale_Optimize(const Config& cfg,
                         int num_whales = 20,
-                        int max_iter   = 200) 
+                        int max_iter   = 200,
+                        Search_Budget* budget = nullptr,
+                        bool use_Heuristic = false) 
 {
+    if (budget) budget->start();
+
     // 1. 初始化種群
     std::vector<Whale> pop;
     pop.reserve(num_whales);
     for (int i = 0; i < num_whales; ++i) {
-        pop.emplace_back(cfg);
+        pop.emplace_back(cfg, use_Heuristic && i == 0);
     }
 
     // 2. 找到初始最優
@@ -108,6 +122,11 @@ Solution Whale_Optimize(const Config& cfg,
     for (auto& w : pop) {
         if (w.cost < best.cost) best = w;
     }
+    Whale offspring = pop[0];   // 重複使用的 offspring 緩衝 (複製建構，不做隨機初始化與評估)
+    if (budget && budget->spend(best.cost, num_whales)) {
+        budget->finish();
+        return static_cast<Solution>(best);
+    }
 
     // 3. 迭代演化
     for (int iter = 1; iter <= max_iter; ++iter) {
@@ -126,12 +145,15 @@ Solution Whale_Optimize(const Config& cfg,
             // 隨機機率 p ∈ [0,1]
             double p = std::generate_canonical<double, 10>(rng);
 
-            // 更新
-            Whale offspring = cur.update(best, randWhale, a, p);
-            // 若後代更優，替換當前
+            // 更新：寫入重複使用的 offspring 緩衝
+            cur.update_into(best, randWhale, a, p, offspring);
+            // 若後代更優，替換當前 (交換緩衝，舊的 current 成為下一次的 offspring 緩衝)
             if (offspring.cost < cur.cost) {
-                pop[i] = std::move(offspring);
+                std::swap(cur, offspring);
             }
+
+            // 中斷後下方仍會更新全局最優
+            if (budget && budget->spend(std::min(best.cost, cur.cost))) break;
         }
 
         // 更新全局最優
@@ -141,9 +163,12 @@ Solution Whale_Optimize(const Config& cfg,
 
         
         // std::cout << "Iter " << iter << ", best makespan = " << best.cost << "\n";
+
+        if (budget && budget->stopped()) break;
     }
 
    
+    if (budget) budget->finish();
     return static_cast<Solution>(best);
 }
 
@@ -2,7 +2,7 @@
 #define WHALE_HPP
 
 #include "include/modules.hpp"
-#include "tabu_search.hpp"
+#include "memetic.hpp"
 #include <algorithm>
 #include <random>
 #include <numeric>
@@ -54,10 +54,10 @@ private:
         ms[idx] = distP(rng);
     }
 
-    // Crossover: take prefix from parentA then fill rest by order from parentB
-    static Vec prefixCrossover(const Vec &parentA, const Vec &parentB) {
+    // Crossover: take prefix from parentA then fill rest by order from parentB (寫入 child，重複使用其記憶體)
+    static void prefixCrossover(const Vec &parentA, const Vec &parentB, Vec &child) {
         int n = parentA.size();
-        Vec child(n, -1);
+        child.resize(n);
         std::uniform_int_distribution<int> dist(1, n-1);
         int cut = dist(rng);
         // prefix
@@ -69,21 +69,22 @@ private:
                 child[idx++] = x;
             }
         }
-        return child;
     }
 
 public:
-    explicit Whale(const Config& cfg) : cfg_(&cfg)
+    explicit Whale(const Config& cfg, bool useHeuristic = false) : cfg_(&cfg)
     {
-        Solution sol = GenerateInitialSolution(cfg);
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         ScheduleResult res = Solution_Function(*this, cfg);
+        cost = res.makespan;
     }
 
-    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
-        Whale offspring(*cfg_);
-        std::uniform_real_distribution<double> leap_dist(0.0, 1.0);
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &randWhale, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
         // Exploration vs Exploitation
         if (p < 0.5) {
             // Exploration: small random mutations
@@ -93,7 +94,7 @@ public:
             mutateMS(offspring.ms, cfg_->thePCount);
         } else {
             // Exploitation: combine with best
-            offspring.ss = prefixCrossover(best.ss, ss);
+            prefixCrossover(best.ss, ss, offspring.ss);
             offspring.ms = ms;
             if (std::abs(a) < 1.0) {
                 // Encircle best: one mutation on ms
@@ -105,13 +106,16 @@ public:
             }
         }
 
-        if (leap_dist(rng) < 0.08) {
-            Tabu_Search( *cfg_ ,  &offspring);
-        }
+        // 局部搜尋改由 Whale_Optimize 每輪以 Memetic_Search 統一執行 (有評估預算)
         
 
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
@@ -1,4 +1,5 @@
 #include "include/modules.hpp"
+#include "include/budget.hpp"
 #include "whale.hpp"
 #include <iostream>
 #include <vector>
@@ -12,22 +13,37 @@ using namespace std::chrono;
 
 
 
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// use_Heuristic：第一隻鯨魚用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 Solution Whale_Optimize(const Config& cfg,
                         int num_whales = 10,
-                        int max_iter   = 200) 
+                        int max_iter   = 200,
+                        const Memetic_Params& memetic_params = Memetic_Params(),
+                        Search_Budget* budget = nullptr,
+                        bool use_Heuristic = false) 
 {
+    if (budget) budget->start();
+
     //  初始化種群
     std::vector<Whale> pop;
     pop.reserve(num_whales);
     for (int i = 0; i < num_whales; ++i) {
-        pop.emplace_back(cfg);
+        pop.emplace_back(cfg, use_Heuristic && i == 0);
     }
 
+    // 局部搜尋 (禁忌清單與暫存解跨迭代重複使用，每輪有評估預算)
+    Memetic_Search memetic(cfg, memetic_params);
+
     // 找到初始最優
     Whale best = pop[0];
     for (auto& w : pop) {
         if (w.cost < best.cost) best = w;
     }
+    Whale offspring = pop[0];   // 重複使用的 offspring 緩衝 (複製建構，不做隨機初始化與評估)
+    if (budget && budget->spend(best.cost, num_whales)) {
+        budget->finish();
+        return static_cast<Solution>(best);
+    }
 
     //  迭代演化
     for (int iter = 1; iter <= max_iter; ++iter) {
@@ -46,12 +62,22 @@ Solution Whale_Optimize(const Config& cfg,
             // 隨機機率 p ∈ [0,1]
             double p = std::generate_canonical<double, 10>(rng);
 
-            // 更新
-            Whale offspring = cur.update(best, randWhale, a, p);
-            // 若後代更優，替換當前
+            // 更新：寫入重複使用的 offspring 緩衝
+            cur.update_into(best, randWhale, a, p, offspring);
+            // 若後代更優，替換當前 (交換緩衝，舊的 current 成為下一次的 offspring 緩衝)
             if (offspring.cost < cur.cost) {
-                pop[i] = std::move(offspring);
+                std::swap(cur, offspring);
             }
+
+            // 中斷後下方仍會更新全局最優
+            if (budget && budget->spend(std::min(best.cost, cur.cost))) break;
+        }
+
+        // 本輪的局部搜尋：挑出最好 / 最分散的鯨魚精煉
+        if (!(budget && budget->stopped())) {
+            memetic.begin_generation(budget && budget->max_evals > 0 ? budget->max_evals - budget->evals : -1);
+            int used = memetic.refine_population(pop, best);
+            if (budget) budget->spend(best.cost, used);
         }
 
         // 更新全局最優
@@ -61,9 +87,12 @@ Solution Whale_Optimize(const Config& cfg,
 
         
         // std::cout << "Iter " << iter << ", best makespan = " << best.cost << "\n";
+
+        if (budget && budget->stopped()) break;
     }
 
    
+    if (budget) budget->finish();
     return static_cast<Solution>(best);
 }
 
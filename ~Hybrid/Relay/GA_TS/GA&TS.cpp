@@ -1,6 +1,7 @@
 #include "include/modules.hpp"
 #include "GA.hpp"
 #include "tabu_search.hpp"
+#include "multi_start_ts.hpp"
 
 #include <iostream>
 #include <vector>
@@ -21,42 +22,29 @@ int main() {
     
 
 
-    int maxIter       = 100;    // 最大迭代次數  
-    int tabuTenure    = 10;    // 禁忌期限  
-    int numCandidates = 40;   // 一次產生的鄰居數量  
-
-    double Avg_Makespan =0;
-    double times = 10;
-
-
     GA_Params params_ga;
     params_ga.population_size = 20;
     params_ga.generations = 100;
 
-    vector<double> GB_Recorder;
-    vector<double> CB_Recorder;
-
-    for (int i ;i<times;i++){
-        
-        
-        Solution GA_Result = Genetic_Algorithm(cfg,params_ga ,  &GB_Recorder);
-        cout<<"GA cost : "<<GA_Result.cost<<endl;
-        Solution TS_Result = Tabu_Search(cfg, &GA_Result ,maxIter, tabuTenure, numCandidates , &GB_Recorder);
-        Solution& best =  TS_Result;
-
-        cout << "Best makespan: " << best.cost << "\n";
-        ScheduleResult sr = Solution_Function(best, cfg , true);
-        show_solution(best);
-        cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
-        cout << "Cost : " << sr.makespan;
-        cout<<"\n\n";
-        Avg_Makespan+=best.cost;
-    }
-    Avg_Makespan /= times;
-    //system("cls");
+    Multi_Start_Params params;
+    params.num_starts    = 10;    // 原本的 times，改為並行多起點
+    params.maxIter       = 100;   // 最大迭代次數  
+    params.tabuTenure    = 10;    // 禁忌期限  
+    params.numCandidates = 40;    // 一次產生的鄰居數量  
+    // 精英池為空時先跑 GA，再以 GA 的結果接 Tabu Search；之後的 start 從精英擾動後重啟
+    params.initial = [&cfg, &params_ga](const Config&) { return Genetic_Algorithm(cfg, params_ga); };
+
+    Run_Statistics stats = Multi_Start_Tabu_Search(cfg, params);
+
+    Solution& best = stats.best_solution;
+    cout << "Best makespan: " << best.cost << "\n";
+    ScheduleResult sr = Solution_Function(best, cfg , true);
+    show_solution(best);
+    cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
+    cout << "Cost : " << sr.makespan;
     cout<<"\n\n";
-    cout<<"Avg Makespan : "<<Avg_Makespan;
 
+    Show_Statistics(stats);
 
     /*writeTwoVectorsToFile(GB_Recorder,CB_Recorder,"data.txt");
     Call_Py_Visual();*/
@@ -11,6 +11,7 @@ struct GA_Params {
     double crossover_rate;
     double mutation_rate;
     std::string selection_method;
+    bool use_Heuristic;         // true：族群的第一個個體用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 
     GA_Params(){
         population_size = 50;
@@ -18,6 +19,7 @@ struct GA_Params {
         crossover_rate = 0.7;
         mutation_rate = 0.4;
         selection_method = "t"; //  鍛造式選擇 t 、 輪盤式 r
+        use_Heuristic = false;
     }
 };
 
@@ -31,8 +33,8 @@ public:
     double fitness;  
 
     Individual() = default;
-    Individual(const Config& cfg) {
-        Solution init = GenerateInitialSolution(cfg);
+    Individual(const Config& cfg, bool useHeuristic = false) {
+        Solution init = GenerateInitialSolution(cfg, useHeuristic);
         this->ss = std::move(init.ss);
         this->ms = std::move(init.ms);
         evaluate(cfg);
@@ -218,7 +220,7 @@ Solution Genetic_Algorithm(Config& config , const GA_Params& params , vector<dou
     std::vector<Individual> population;
     population.reserve(params.population_size);
     for (int i = 0; i < params.population_size; ++i) {
-        population.emplace_back(config);
+        population.emplace_back(config, params.use_Heuristic && i == 0);
     }
     Individual best_so_far = population[0];
 
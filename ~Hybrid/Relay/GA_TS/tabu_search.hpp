@@ -1,3 +1,6 @@
+#ifndef TABU_SEARCH_HPP
+#define TABU_SEARCH_HPP
+
 #include "include/modules.hpp"
 #include <deque>
 #include <utility>   
@@ -164,10 +167,11 @@ private:
 
 
 // 主 Tabu Search 演算法
-Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr) {
+// Initial_Solution 為 nullptr 時由 GenerateInitialSolution 產生起點 (use_Heuristic = true 用 HEFT 解)
+Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr , bool use_Heuristic = false) {
     // INITIAL SOLUTION
     Solution  current;
-    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, false);
+    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, use_Heuristic);
     else                                current      = *Initial_Solution;
 
     double currentCost    = Evaluate(current, cfg);
@@ -235,3 +239,5 @@ Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  ,
 
     return bestSolution;
 }
+
+#endif
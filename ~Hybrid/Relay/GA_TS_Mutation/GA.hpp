@@ -2,7 +2,7 @@
 #define IDEVIUAL_HPP
 
 #include "include/modules.hpp"
-#include "tabu_search.hpp"
+#include "memetic.hpp"
 
 
 // ----- GA Parameters ------
@@ -12,6 +12,8 @@ struct GA_Params {
     double crossover_rate;
     double mutation_rate;
     std::string selection_method;
+    bool use_Heuristic;         // true：族群的第一個個體用 HEFT 解 (見 include/heft.hpp)，其餘隨機
+    Memetic_Params memetic;     // 每代的局部搜尋 (generation_evals <= 0 則關閉)
 
     GA_Params(){
         population_size = 50;
@@ -19,6 +21,8 @@ struct GA_Params {
         crossover_rate = 0.7;
         mutation_rate = 0.4;
         selection_method = "t"; //  鍛造式選擇 t 、 輪盤式 r
+        use_Heuristic = false;
+        memetic.target = Memetic_Target::MIXED;   // GA 族群分散，最好與最分散的個體輪流精煉效果較好
     }
 };
 
@@ -32,8 +36,8 @@ public:
     double fitness;  
 
     Individual() = default;
-    Individual(const Config& cfg) {
-        Solution init = GenerateInitialSolution(cfg);
+    Individual(const Config& cfg, bool useHeuristic = false) {
+        Solution init = GenerateInitialSolution(cfg, useHeuristic);
         this->ss = std::move(init.ss);
         this->ms = std::move(init.ms);
         evaluate(cfg);
@@ -89,15 +93,8 @@ public:
         return child;
     }
 
-    // Mutation
-   void mutate(const Config& cfg,
-                double mutation_rate,
-                // Tabu Search 參數
-                double tabu_probability = 0.2,   // 20% 機率觸發
-                int tabuMaxIter     = 10,
-                int tabuTenure      = 5,
-                int tabuCandidates  = 20)
-    {
+    // Mutation (局部搜尋改由 Genetic_Algorithm 每代以 Memetic_Search 統一執行，有預算控管)
+    void mutate(const Config& cfg, double mutation_rate) {
         int T = cfg.theTCount;
         int P = cfg.thePCount;
         std::uniform_real_distribution<double> uni_rnd(0.0, 1.0);
@@ -118,35 +115,7 @@ public:
             changed = true;
         }
 
-        if (!changed) 
-            return;   // 若沒做變動，就不跑 evaluate 也不跑 Tabu
-
-        // 普通評估
-        evaluate(cfg);
-
-        // 決定是否觸發 Tabu Search
-        if (uni_rnd(rng) < tabu_probability) {
-            // 包裝初始解
-            Solution initSol;
-            initSol.ss   = this->ss;
-            initSol.ms   = this->ms;
-            initSol.cost = this->cost;
-
-            // 執行 Tabu Search 局部精煉
-            Solution refined = Tabu_Search(cfg,
-                                           &initSol,
-                                           tabuMaxIter,
-                                           tabuTenure,
-                                           tabuCandidates);
-
-            // 用 Tabu 結果覆蓋
-            this->ss   = std::move(refined.ss);
-            this->ms   = std::move(refined.ms);
-            this->cost = refined.cost;
-        }
-
-        // 最後再算一次 fitness
-        this->fitness = 1.0 / (this->cost + 1e-9);
+        if (changed) evaluate(cfg);   // 若沒做變動，就不跑 evaluate
     }
 
      
@@ -249,13 +218,14 @@ namespace Selection_For_GA {
 
 
 // Genetic Algorith API , Need To Give The Config And Parameter of GA
+// 每代在 params.memetic.generation_evals 的評估預算內做局部搜尋 (Lamarckian / Baldwinian、挑最好或最分散的個體)
 Solution Genetic_Algorithm(Config& config , const GA_Params& params , vector<double>* GB_Recorder = nullptr , vector<double>* LB_Recorder = nullptr) {
     
     // Population
     std::vector<Individual> population;
     population.reserve(params.population_size);
     for (int i = 0; i < params.population_size; ++i) {
-        population.emplace_back(config);
+        population.emplace_back(config, params.use_Heuristic && i == 0);
     }
     Individual best_so_far = population[0];
 
@@ -264,6 +234,10 @@ Solution Genetic_Algorithm(Config& config , const GA_Params& params , vector<dou
     mating_pool.reserve(params.population_size);
     next_pop.reserve(params.population_size);
 
+    // 局部搜尋 (禁忌清單與暫存解跨世代重複使用)
+    Memetic_Search memetic(config, params.memetic);
+    auto sync_fitness = [](Individual& ind){ ind.fitness = 1.0 / (ind.cost + 1e-9); };
+
     // Evolutaion Iteration
     for (int gen = 0; gen < params.generations; ++gen) {
 
@@ -288,6 +262,11 @@ Solution Genetic_Algorithm(Config& config , const GA_Params& params , vector<dou
         
         population.swap(next_pop);
 
+        // 本代的局部搜尋：依規則挑出個體，在 generation_evals 內精煉
+        memetic.begin_generation();
+        memetic.refine_population(population, best_so_far, sync_fitness);
+        sync_fitness(best_so_far);
+
 
         if (GB_Recorder || LB_Recorder) {
             double best_cost = std::numeric_limits<double>::infinity();
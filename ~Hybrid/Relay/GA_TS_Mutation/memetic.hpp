@@ -0,0 +1,188 @@
+#ifndef MEMETIC_HPP
+#define MEMETIC_HPP
+
+#include "include/modules.hpp"
+#include "tabu_search.hpp"
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+
+// ----- Memetic Local Search Parameters ------
+enum class Memetic_Mode {
+    LAMARCKIAN,     // 精煉後的 ss / ms / cost 寫回個體
+    BALDWINIAN      // 只寫回 cost (基因不變，cost 成為代理值)，精煉到的解仍會更新 global best
+};
+
+enum class Memetic_Target {
+    PROMISING,      // cost 最好的個體
+    DIVERSE,        // 與 global best 距離最遠的個體 (ms Hamming + ss 位置不同數)
+    MIXED           // 兩者輪流
+};
+
+struct Memetic_Params {
+    int generation_evals;   // 每代局部搜尋的評估預算 (所有被精煉的個體共用)
+    int call_evals;         // 單一個體最多花的評估數
+    int candidates;         // 每步產生的鄰居數
+    int tenure;             // 禁忌期限
+    int targets;            // 每代最多精煉幾個個體
+    Memetic_Mode mode;
+    Memetic_Target target;
+
+    Memetic_Params(){
+        generation_evals = 150;
+        call_evals       = 50;
+        candidates       = 10;
+        tenure           = 5;
+        targets          = 3;
+        mode             = Memetic_Mode::LAMARCKIAN;
+        target           = Memetic_Target::PROMISING;
+    }
+};
+
+
+
+
+// Memetic Local Search
+// 短程 tabu search：鄰居在重複使用的暫存解上原地套用 Move 後評估，
+// 禁忌清單與暫存解在多次呼叫之間保留，每次精煉不重新配置；
+// 每代的評估預算由 begin_generation() 重設，用完就停止精煉
+class Memetic_Search {
+public:
+    Memetic_Search(const Config& cfg, const Memetic_Params& params = Memetic_Params())
+        : cfg_(&cfg), params_(params), tabu_(params.tenure), left_(params.generation_evals) {}
+
+    // max_evals：這一代最多能用的評估數 (< 0 = 不限制，例如 budget 剩下的評估數)
+    void begin_generation(long long max_evals = -1) {
+        left_ = params_.generation_evals;
+        if (max_evals >= 0 && max_evals < left_) left_ = (int)max_evals;
+    }
+    int remaining() const { return left_; }
+
+    // 精煉 sol (sol.cost 需為已評估的值)，回傳花掉的評估數
+    // Lamarckian 寫回 ss / ms / cost，Baldwinian 只寫回 cost；精煉到的最佳解可由 refined() 取得
+    // Baldwinian 時 sol.cost 可能是上次精煉留下的代理值，所以先重新評估基因 (算一次評估)，
+    // 搜尋與 refined() 都以基因的真實 cost 為準
+    int refine(Solution& sol) {
+        int budget = std::min(params_.call_evals, left_);
+        current_ = sol;
+        best_    = sol;
+        if (budget <= 0) return 0;
+
+        int used = 0;
+        if (params_.mode == Memetic_Mode::BALDWINIAN) {
+            current_.cost = Evaluate(current_, *cfg_);
+            best_ = current_;
+            used++;
+        }
+        double start_cost = current_.cost;
+        double current_cost = start_cost;
+        tabu_.clear();
+        while (used < budget) {
+            bool found = false;
+            double chosen_cost = 0.0;
+            Move chosen_move;
+            for (int k = 0; k < params_.candidates && used < budget; ++k) {
+                trial_ = current_;
+                Move m = Apply_Random_Move(trial_, *cfg_);
+                double c = Evaluate(trial_, *cfg_);
+                trial_.cost = c;
+                used++;
+                // 非禁忌，或符合 Aspiration (比目前最佳好)
+                if (tabu_.contains(m) && c >= best_.cost) continue;
+                if (!found || c < chosen_cost) {
+                    std::swap(chosen_, trial_);
+                    chosen_cost = c;
+                    chosen_move = m;
+                    found = true;
+                }
+            }
+            if (!found) continue;
+
+            tabu_.add(chosen_move);
+            tabu_.decrementTenure();
+            std::swap(current_, chosen_);
+            current_cost = chosen_cost;
+            if (current_cost < best_.cost) best_ = current_;
+        }
+
+        left_ -= used;
+        total_evals_ += used;
+        calls_++;
+        if (best_.cost < start_cost) {
+            improvements_++;
+            if (params_.mode == Memetic_Mode::LAMARCKIAN) sol = best_;
+            else sol.cost = best_.cost;
+        }
+        return used;
+    }
+
+    // 依 target 規則挑選個體精煉，直到本代預算用完或達到 targets 個
+    // on_refined(ind) 在個體被精煉後呼叫 (例如更新 fitness)；global_best 會以精煉到的解更新
+    // 回傳花掉的評估數
+    template <typename Indiv, typename On_Refined>
+    int refine_population(std::vector<Indiv>& pop, Solution& global_best, On_Refined on_refined) {
+        int n = pop.size();
+        if (n == 0 || left_ <= 0) return 0;
+
+        by_cost_.resize(n);
+        std::iota(by_cost_.begin(), by_cost_.end(), 0);
+        std::sort(by_cost_.begin(), by_cost_.end(),
+            [&pop](int a, int b){ return pop[a].cost < pop[b].cost; });
+        if (params_.target != Memetic_Target::PROMISING) {
+            distance_.assign(n, 0);
+            for (int i = 0; i < n; ++i)
+                for (size_t t = 0; t < pop[i].ss.size(); ++t)
+                    distance_[i] += (pop[i].ss[t] != global_best.ss[t]) + (pop[i].ms[t] != global_best.ms[t]);
+            by_distance_.resize(n);
+            std::iota(by_distance_.begin(), by_distance_.end(), 0);
+            std::stable_sort(by_distance_.begin(), by_distance_.end(),
+                [this](int a, int b){ return distance_[a] > distance_[b]; });
+        }
+
+        picked_.assign(n, 0);
+        int used = 0, done = 0, ip = 0, id = 0;
+        for (int k = 0; done < params_.targets && left_ > 0 && k < 2 * n; ++k) {
+            bool diverse = params_.target == Memetic_Target::DIVERSE
+                        || (params_.target == Memetic_Target::MIXED && (k % 2 == 1));
+            std::vector<int>& order = diverse ? by_distance_ : by_cost_;
+            int& pos = diverse ? id : ip;
+            while (pos < n && picked_[order[pos]]) ++pos;
+            if (pos >= n) continue;
+            int i = order[pos];
+            picked_[i] = 1;
+
+            used += refine(pop[i]);
+            on_refined(pop[i]);
+            if (best_.cost < global_best.cost) global_best = best_;
+            done++;
+        }
+        return used;
+    }
+
+    template <typename Indiv>
+    int refine_population(std::vector<Indiv>& pop, Solution& global_best) {
+        return refine_population(pop, global_best, [](Indiv&){});
+    }
+
+    const Solution& refined() const { return best_; }
+    long long total_evals() const { return total_evals_; }
+    long long calls() const { return calls_; }
+    long long improvements() const { return improvements_; }
+
+private:
+    const Config* cfg_;
+    Memetic_Params params_;
+    Tabu_List tabu_;
+    int left_;
+
+    Solution current_, trial_, chosen_, best_;      // 重複使用的暫存解
+    std::vector<int> by_cost_, by_distance_, distance_;
+    std::vector<char> picked_;
+
+    long long total_evals_ = 0;
+    long long calls_ = 0;
+    long long improvements_ = 0;
+};
+
+#endif
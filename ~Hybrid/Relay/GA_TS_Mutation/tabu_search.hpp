@@ -51,8 +51,8 @@ struct NeighborInfo {
 
 
 
-NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg) {
-    Solution neighbor = current;      
+// 在 sol 上原地套用一個隨機 Move (不評估)，回傳該 Move
+Move Apply_Random_Move(Solution& sol, const Config& cfg) {
     int T = cfg.theTCount;
     int P = cfg.thePCount;
 
@@ -67,7 +67,7 @@ NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg)
         int i = distT(rng), j = distT(rng);
         while (j == i) j = distT(rng);
         m.i = i; m.j = j;
-        std::swap(neighbor.ss[i], neighbor.ss[j]);
+        std::swap(sol.ss[i], sol.ss[j]);
     } else {
         // Change MS
         m.type = CHANGE_MS;
@@ -75,14 +75,21 @@ NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg)
         std::uniform_int_distribution<int> distP(0, P - 1);
         int t = distT(rng);
         int newP = distP(rng);
-        while (newP == neighbor.ms[t] && P > 1) {
+        while (newP == sol.ms[t] && P > 1) {
             newP = distP(rng);
         }
         m.t     = t;
-        m.old_P = neighbor.ms[t];
+        m.old_P = sol.ms[t];
         m.new_P = newP;
-        neighbor.ms[t] = newP;
+        sol.ms[t] = newP;
     }
+    return m;
+}
+
+
+NeighborInfo Tabu_Generate_Neighbor(const Solution& current, const Config& cfg) {
+    Solution neighbor = current;      
+    Move m = Apply_Random_Move(neighbor, cfg);
 
     
     double c = Evaluate(neighbor, cfg);
@@ -130,6 +137,9 @@ public:
         return false;
     }
 
+    // 清空 (重複使用同一個 Tabu_List 時)
+    void clear() { list_.clear(); }
+
     // (3) 每一次主迴圈結束，都要呼叫一次 decrementTenure()，
     void decrementTenure() {
         for (auto it = list_.begin(); it != list_.end();) {
@@ -164,10 +174,11 @@ private:
 
 
 // 主 Tabu Search 演算法
-Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr) {
+// Initial_Solution 為 nullptr 時由 GenerateInitialSolution 產生起點 (use_Heuristic = true 用 HEFT 解)
+Solution Tabu_Search(const Config& cfg, Solution* Initial_Solution = nullptr  , int maxIter = 10 , int tabuTenure = 5 , int numCandidates = 20 , vector<double>* GB_Recorder = nullptr ,vector<double>* CB_Recorder= nullptr , bool use_Heuristic = false) {
     // INITIAL SOLUTION
     Solution  current;
-    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, false);
+    if (Initial_Solution == nullptr)   current       = GenerateInitialSolution(cfg, use_Heuristic);
     else                                current      = *Initial_Solution;
 
     double currentCost    = Evaluate(current, cfg);
@@ -1,6 +1,7 @@
 #include "include/modules.hpp"
 #include "WOA.hpp"
 #include "tabu_search.hpp"
+#include "multi_start_ts.hpp"
 
 #include <iostream>
 #include <vector>
@@ -21,35 +22,25 @@ int main() {
     
 
 
-    int maxIter       = 100;    // 最大迭代次數  
-    int tabuTenure    = 10;    // 禁忌期限  
-    int numCandidates = 40;   // 一次產生的鄰居數量  
+    Multi_Start_Params params;
+    params.num_starts    = 10;    // 原本的 times，改為並行多起點
+    params.maxIter       = 100;   // 最大迭代次數  
+    params.tabuTenure    = 10;    // 禁忌期限  
+    params.numCandidates = 40;    // 一次產生的鄰居數量  
+    // 精英池為空時先跑 WOA，再以 WOA 的結果接 Tabu Search；之後的 start 從精英擾動後重啟
+    params.initial = [&params](const Config& c) { return Whale_Optimize(c, 30, params.maxIter); };
 
-    double Avg_Makespan =0;
-    double times = 10;
+    Run_Statistics stats = Multi_Start_Tabu_Search(cfg, params);
 
- 
+    Solution& best = stats.best_solution;
+    cout << "Best makespan: " << best.cost << "\n";
+    ScheduleResult sr = Solution_Function(best, cfg , true);
+    show_solution(best);
+    cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
+    cout << "Cost : " << sr.makespan;
+    cout<<"\n\n";
 
+    Show_Statistics(stats);
 
-    for (int i ;i<times;i++){
-        
-        
-        Solution WOA_Result = Whale_Optimize(cfg , 30 , maxIter);
-        Solution TS_Result = Tabu_Search(cfg, &WOA_Result ,maxIter, tabuTenure, numCandidates);
-        Solution& best =  TS_Result;
-
-        cout << "Best makespan: " << best.cost << "\n";
-        ScheduleResult sr = Solution_Function(best, cfg , true);
-        show_solution(best);
-        cout << "Feasible: " << std::boolalpha << is_feasible(sr, cfg) << "\n";
-        cout << "Cost : " << sr.makespan;
-        cout<<"\n\n";
-        Avg_Makespan+=best.cost;
-        
-    }
-    Avg_Makespan /= times;
-    //system("cls");
-    cout<<"\n\n";
-    cout<<"Avg Makespan : "<<Avg_Makespan;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef BUDGET_HPP
+#define BUDGET_HPP
+
+#include <chrono>
+
+// 停止原因
+enum class Stop_Reason {
+    NONE,
+    MAX_ITERATION,     // 跑完原本的迭代次數
+    DEADLINE,          // 超過 wall-clock 時間限制
+    MAX_EVALUATIONS,   // 超過評估次數上限
+    TARGET_REACHED,    // 已達到目標 makespan
+    NO_IMPROVE         // 連續無改善 (演算法自己的停止條件)
+};
+
+inline const char* Stop_Reason_Name(Stop_Reason r) {
+    switch (r) {
+        case Stop_Reason::MAX_ITERATION:   return "max iteration";
+        case Stop_Reason::DEADLINE:        return "deadline";
+        case Stop_Reason::MAX_EVALUATIONS: return "max evaluations";
+        case Stop_Reason::TARGET_REACHED:  return "target reached";
+        case Stop_Reason::NO_IMPROVE:      return "no improve";
+        default:                           return "none";
+    }
+}
+
+
+// Search Budget：每個搜尋引擎共用的停止條件 (時間 / 評估次數 / 目標 makespan)
+// 引擎在每次評估後呼叫 spend()，回傳 true 代表要停下並回傳目前最佳解
+struct Search_Budget {
+    double time_limit_ms;     // wall-clock 上限 (ms)，<= 0 不限制
+    long long max_evals;      // 評估次數上限，<= 0 不限制
+    double target_cost;       // 達到 (<=) 此 makespan 即停止，<= 0 不限制
+    int check_interval;       // 累積幾次評估才讀一次時鐘 (一次 spend 記了 n 次就算 n 次)
+
+    // ---- 執行狀態 (由引擎更新) ----
+    long long evals;
+    Stop_Reason reason;
+    double elapsed_ms;
+
+    Search_Budget(double time_ms = 0, long long evals_ = 0, double target = 0)
+        : time_limit_ms(time_ms), max_evals(evals_), target_cost(target), check_interval(8),
+          evals(0), reason(Stop_Reason::NONE), elapsed_ms(0.0), tick_(0) {}
+
+    // 引擎開始時呼叫
+    void start() {
+        start_ = std::chrono::steady_clock::now();
+        evals = 0;
+        reason = Stop_Reason::NONE;
+        elapsed_ms = 0.0;
+        tick_ = 0;
+    }
+
+    // 記錄 n 次評估，並檢查是否該停止
+    bool spend(double best_cost, long long n = 1) {
+        evals += n;
+        if (reason != Stop_Reason::NONE) return true;
+        if (target_cost > 0 && best_cost <= target_cost) reason = Stop_Reason::TARGET_REACHED;
+        else if (max_evals > 0 && evals >= max_evals)    reason = Stop_Reason::MAX_EVALUATIONS;
+        else if (time_limit_ms > 0 && (tick_ += n) >= check_interval) {
+            tick_ = 0;
+            if (elapsed() >= time_limit_ms) reason = Stop_Reason::DEADLINE;
+        }
+        return reason != Stop_Reason::NONE;
+    }
+
+    bool stopped() const { return reason != Stop_Reason::NONE; }
+
+    // 引擎結束時呼叫，沒有觸發 budget 則記為 default_reason
+    void finish(Stop_Reason default_reason = Stop_Reason::MAX_ITERATION) {
+        if (reason == Stop_Reason::NONE) reason = default_reason;
+        elapsed_ms = elapsed();
+    }
+
+    double elapsed() const {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+    long long tick_;
+};
+
+#endif
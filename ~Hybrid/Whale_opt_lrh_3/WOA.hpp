@@ -5,7 +5,8 @@
 
 
 #include "include/modules.hpp"
-#include "tabu_search.hpp"
+#include "include/budget.hpp"
+#include "memetic.hpp"
 #include <algorithm>
 #include <random>
 #include <numeric>
@@ -19,14 +20,17 @@ private:
 
     // --- Discrete operators for ss 排序 ---
     // 1. Encircle (圍捕): SwapTowardBest — bring ss closer to best solution
+    //    先建 best 的反排列 (task -> 位置)，每次比較 O(1)，整體 O(n) 而不是 O(n²)
     static void swapTowardBestSS(Vec &ss, const Vec &best, double A) {
         int n = ss.size();
+        thread_local Vec posBest;
+        posBest.resize(n);
+        for (int k = 0; k < n; ++k) posBest[best[k]] = k;
         int m = std::ceil(std::abs(A) * n / 2.0);
         std::uniform_int_distribution<int> dist(0, n - 1);
         while (m-- > 0) {
             int i = dist(rng), j = dist(rng);
-            auto pos_i = std::find(best.begin(), best.end(), ss[i]) - best.begin();
-            auto pos_j = std::find(best.begin(), best.end(), ss[j]) - best.begin();
+            int pos_i = posBest[ss[i]], pos_j = posBest[ss[j]];
             if ((i < j && pos_i > pos_j) || (i > j && pos_i < pos_j)) {
                 std::swap(ss[i], ss[j]);
             }
@@ -44,15 +48,17 @@ private:
     }
 
     // 3. Exploration (搜索): BlockShuffle — cut and insert
+    //    片段 [i, j] 移到剩餘序列的第 q 個位置，以 rotate 原地完成 (不配置、不 erase / insert)
     static void blockShuffleSS(Vec &ss) {
         int n = ss.size(); if (n < 2) return;
         std::uniform_int_distribution<int> dist(0, n - 1);
         int i = dist(rng), j = dist(rng);
         if (i > j) std::swap(i, j);
-        Vec segment(ss.begin() + i, ss.begin() + j + 1);
-        ss.erase(ss.begin() + i, ss.begin() + j + 1);
-        std::uniform_int_distribution<int> distPos(0, ss.size());
-        ss.insert(ss.begin() + distPos(rng), segment.begin(), segment.end());
+        int len = j - i + 1;
+        std::uniform_int_distribution<int> distPos(0, n - len);
+        int q = distPos(rng);
+        if (q <= i) std::rotate(ss.begin() + q, ss.begin() + i, ss.begin() + j + 1);
+        else        std::rotate(ss.begin() + i, ss.begin() + j + 1, ss.begin() + j + 1 + (q - i));
     }
 
     // --- Discrete operators for ms 匹配 ---
@@ -84,16 +90,18 @@ private:
     }
 
 public:
-    explicit Whale(const Config& cfg) : cfg_(&cfg) {
-        Solution sol = GenerateInitialSolution(cfg);
+    explicit Whale(const Config& cfg, bool useHeuristic = false) : cfg_(&cfg) {
+        Solution sol = GenerateInitialSolution(cfg, useHeuristic);
         ss = std::move(sol.ss);
         ms = std::move(sol.ms);
         ScheduleResult res = Solution_Function(*this, cfg);
         cost = res.makespan;
     }
 
-    Whale update(const Whale &best, const Whale &/*randWhale*/, double a, double p) const {
-        Whale offspring(*cfg_);
+    // offspring 寫入呼叫端的緩衝 (ss / ms 以 assign 重複使用記憶體)，只評估一次；
+    // offspring 不可與 *this、best、randWhale 為同一個物件
+    void update_into(const Whale &best, const Whale &/*randWhale*/, double a, double p, Whale &offspring) const {
+        offspring.cfg_ = cfg_;
         offspring.ss = ss;
         offspring.ms = ms;
 
@@ -117,34 +125,52 @@ public:
             singleSwapMS(offspring.ms);
         }
 
-        if (std::uniform_real_distribution<double>(0,1)(rng) < 0.08) {
-            Tabu_Search( *cfg_ ,  &offspring);
-        }
+        // 局部搜尋改由 Whale_Optimize 每輪以 Memetic_Search 統一執行 (有評估預算)
 
         ScheduleResult res = Solution_Function(offspring, *cfg_);
         offspring.cost = res.makespan;
+    }
+
+    Whale update(const Whale &best, const Whale &randWhale, double a, double p) const {
+        Whale offspring(*this);   // 複製建構：不做隨機初始化與評估
+        update_into(best, randWhale, a, p, offspring);
         return offspring;
     }
 };
 
 
+// budget 不為 nullptr 時，時間 / 評估次數 / 目標 makespan 任一達到就回傳目前最佳解，停止原因記在 budget->reason
+// use_Heuristic：第一隻鯨魚用 HEFT 解 (見 include/heft.hpp)，其餘隨機
 Solution Whale_Optimize(const Config& cfg,
                         int num_whales = 20,
                         int max_iter   = 200,
-                    vector<double>* GB_Recorder = nullptr , vector<double>* PB_Recorder = nullptr) 
+                    vector<double>* GB_Recorder = nullptr , vector<double>* PB_Recorder = nullptr,
+                        const Memetic_Params& memetic_params = Memetic_Params(),
+                        Search_Budget* budget = nullptr,
+                        bool use_Heuristic = false) 
 {
+    if (budget) budget->start();
+
     // 1. 初始化種群
     std::vector<Whale> pop;
     pop.reserve(num_whales);
     for (int i = 0; i < num_whales; ++i) {
-        pop.emplace_back(cfg);
+        pop.emplace_back(cfg, use_Heuristic && i == 0);
     }
 
+    // 局部搜尋 (禁忌清單與暫存解跨迭代重複使用，每輪有評估預算)
+    Memetic_Search memetic(cfg, memetic_params);
+
     // 2. 找到初始最優
     Whale best = pop[0];
     for (auto& w : pop) {
         if (w.cost < best.cost) best = w;
     }
+    Whale offspring = pop[0];   // 重複使用的 offspring 緩衝 (複製建構，不做隨機初始化與評估)
+    if (budget && budget->spend(best.cost, num_whales)) {
+        budget->finish();
+        return static_cast<Solution>(best);
+    }
 
     // 3. 迭代演化
     for (int iter = 1; iter <= max_iter; ++iter) {
@@ -163,12 +189,22 @@ Solution Whale_Optimize(const Config& cfg,
             // 隨機機率 p ∈ [0,1]
             double p = std::generate_canonical<double, 10>(rng);
 
-            // 更新
-            Whale offspring = cur.update(best, randWhale, a, p);
-            // 若後代更優，替換當前
+            // 更新：寫入重複使用的 offspring 緩衝
+            cur.update_into(best, randWhale, a, p, offspring);
+            // 若後代更優，替換當前 (交換緩衝，舊的 current 成為下一次的 offspring 緩衝)
             if (offspring.cost < cur.cost) {
-                pop[i] = std::move(offspring);
+                std::swap(cur, offspring);
             }
+
+            // 中斷後下方仍會更新全局最優
+            if (budget && budget->spend(std::min(best.cost, cur.cost))) break;
+        }
+
+        // 本輪的局部搜尋：挑出最好 / 最分散的鯨魚精煉
+        if (!(budget && budget->stopped())) {
+            memetic.begin_generation(budget && budget->max_evals > 0 ? budget->max_evals - budget->evals : -1);
+            int used = memetic.refine_population(pop, best);
+            if (budget) budget->spend(best.cost, used);
         }
 
         double Avg_Cost_Pop = 0;
@@ -183,9 +219,12 @@ Solution Whale_Optimize(const Config& cfg,
         
         
         // std::cout << "Iter " << iter << ", best makespan = " << best.cost << "\n";
+
+        if (budget && budget->stopped()) break;
     }
 
    
+    if (budget) budget->finish();
     return static_cast<Solution>(best);
 }
 